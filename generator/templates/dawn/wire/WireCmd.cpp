@@ -304,19 +304,14 @@
             {% endif %}
                 auto memberLength = {{member_length(member, "record.")}};
 
-                {{member_transfer_type(member)}}* memberBuffer;
-                WIRE_TRY(buffer->NextN(memberLength, &memberBuffer));
-
                 {% if member.type.is_wire_transparent %}
-                    //* memcpy is not defined for null pointers, even when the length is zero.
-                    //* conflicts with the common practice to use (nullptr, 0) to represent an
-                    //* span. Guard memcpy with a zero check to work around this language bug.
-                    if (memberLength != 0) {
-                        memcpy(
-                            memberBuffer, record.{{memberName}},
-                            {{member_transfer_sizeof(member)}} * memberLength);
-                    }
+                    static_assert(sizeof(*record.{{memberName}}) == {{member_transfer_sizeof(member)}},
+                                  "Serialize copy size must match.");
+                    WIRE_TRY(buffer->CopyN(record.{{memberName}}, memberLength));
                 {% else %}
+                    {{member_transfer_type(member)}}* memberBuffer;
+                    WIRE_TRY(buffer->NextN(memberLength, &memberBuffer));
+
                     //* This loop cannot overflow because it iterates up to |memberLength|. Even if
                     //* memberLength were the maximum integer value, |i| would become equal to it
                     //* just before exiting the loop, but not increment past or wrap around.
@@ -200,6 +200,16 @@ DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+// Process-wide counters of the command block allocations, for tests and benchmarks.
+struct CommandAllocatorCounters {
+    // Blocks that had to be allocated from the system allocator, and their total size.
+    uint64_t blocksAllocated = 0;
+    uint64_t bytesAllocated = 0;
+    // Block requests that were served by the per-thread cache of released blocks.
+    uint64_t blocksRecycled = 0;
+};
+DAWN_NATIVE_EXPORT CommandAllocatorCounters GetCommandAllocatorCountersForTesting();
+
 //  Query if texture has been initialized
 DAWN_NATIVE_EXPORT bool IsTextureSubresourceInitialized(
     WGPUTexture texture,
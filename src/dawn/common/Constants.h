@@ -85,6 +85,10 @@ static constexpr uint8_t kMaxPLSSize = kMaxPLSSlots * kPLSSlotByteSize;
 // Wire buffer alignments.
 static constexpr size_t kWireBufferAlignment = 8u;
 
+// Largest staging buffer for chunked wire commands that is kept around to be reused by the next
+// chunked command. Larger staging buffers are freed after each use.
+static constexpr size_t kMaxRetainedWireChunkedCommandSize = 1u * 1024u * 1024u;
+
 // Timestamp query quantization mask to perform a granularity of ~0.1ms.
 static constexpr uint32_t kTimestampQuantizationMask = 0xFFFF0000;
 
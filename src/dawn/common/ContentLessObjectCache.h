@@ -28,7 +28,10 @@
 #ifndef SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 #define SRC_DAWN_COMMON_CONTENTLESSOBJECTCACHE_H_
 
+#include <array>
+#include <cstdint>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
 
@@ -87,8 +90,6 @@ struct ContentLessObjectCacheKeyFuncs {
     struct EqualityFunc {
         using is_transparent = void;
 
-        explicit EqualityFunc(ContentLessObjectCache<RefCountedT>* cache) : mCache(cache) {}
-
         bool operator()(const WeakRefAndHash<RefCountedT>& a,
                         const WeakRefAndHash<RefCountedT>& b) const {
             Ref<RefCountedT> aRef = a.weakRef.Promote();
@@ -96,10 +97,10 @@ struct ContentLessObjectCacheKeyFuncs {
 
             bool equal = (aRef && bRef && BaseEqualityFunc()(aRef.Get(), bRef.Get()));
             if (aRef) {
-                mCache->TrackTemporaryRef(std::move(aRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(aRef));
             }
             if (bRef) {
-                mCache->TrackTemporaryRef(std::move(bRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(bRef));
             }
             return equal;
         }
@@ -110,7 +111,7 @@ struct ContentLessObjectCacheKeyFuncs {
             //   (1) a == b, in which case that means we are destroying the last copy and must be
             //       valid because cached objects must uncache themselves before being completely
             //       destroyed.
-            //   (2) a != b, in which case the lock on the cache guarantees that the element in the
+            //   (2) a != b, in which case the lock on the shard guarantees that the element in the
             //       cache has not been erased yet and hence cannot have been destroyed.
             return a.weakRef.UnsafeGet() == b.value;
         }
@@ -119,12 +120,10 @@ struct ContentLessObjectCacheKeyFuncs {
             Ref<RefCountedT> aRef = a.weakRef.Promote();
             bool equal = aRef && BaseEqualityFunc()(aRef.Get(), b);
             if (aRef) {
-                mCache->TrackTemporaryRef(std::move(aRef));
+                ContentLessObjectCache<RefCountedT>::TrackTemporaryRef(std::move(aRef));
             }
             return equal;
         }
-
-        raw_ptr<ContentLessObjectCache<RefCountedT>> mCache = nullptr;
     };
 };
 
@@ -140,10 +139,7 @@ class ContentLessObjectCache {
     using CacheKeyFuncs = detail::ContentLessObjectCacheKeyFuncs<RefCountedT>;
 
   public:
-    ContentLessObjectCache()
-        : mCache(/*capacity=*/0,
-                 typename CacheKeyFuncs::HashFunc(),
-                 typename CacheKeyFuncs::EqualityFunc(this)) {}
+    ContentLessObjectCache() = default;
 
     // The dtor asserts that the cache is empty to aid in finding pointer leaks that can be
     // possible if the RefCountedT doesn't correctly implement the DeleteThis function to Uncache.
@@ -153,33 +149,41 @@ class ContentLessObjectCache {
     // inserted or existing object, and the second is a bool that is true if we inserted
     // `object` and false otherwise.
     std::pair<Ref<RefCountedT>, bool> Insert(RefCountedT* obj) {
-        return WithLockAndCleanup([&]() -> std::pair<Ref<RefCountedT>, bool> {
-            auto [it, inserted] = mCache.emplace(obj);
-            if (inserted) {
-                obj->mCache = this;
-                return {obj, inserted};
-            } else {
-                // Try to promote the found WeakRef to a Ref. If promotion fails, remove the old Key
-                // and insert this one.
-                Ref<RefCountedT> ref = it->weakRef.Promote();
-                if (ref != nullptr) {
-                    return {std::move(ref), false};
-                } else {
-                    mCache.erase(it);
-                    auto result = mCache.emplace(obj);
-                    DAWN_ASSERT(result.second);
+        Shard& shard = GetShard(typename CacheKeyFuncs::HashFunc()(obj));
+        return WithLockAndCleanup<std::unique_lock>(
+            shard, [&]() -> std::pair<Ref<RefCountedT>, bool> {
+                // Most insertions are made right after a failed Find, but the object may have been
+                // inserted by another thread in between, so the lookup is redone under the
+                // exclusive lock.
+                auto [it, inserted] = shard.cache.emplace(obj);
+                if (inserted) {
                     obj->mCache = this;
-                    return {obj, true};
+                    return {obj, inserted};
+                } else {
+                    // Try to promote the found WeakRef to a Ref. If promotion fails, remove the old
+                    // Key and insert this one.
+                    Ref<RefCountedT> ref = it->weakRef.Promote();
+                    if (ref != nullptr) {
+                        return {std::move(ref), false};
+                    } else {
+                        shard.cache.erase(it);
+                        auto result = shard.cache.emplace(obj);
+                        DAWN_ASSERT(result.second);
+                        obj->mCache = this;
+                        return {obj, true};
+                    }
                 }
-            }
-        });
+            });
     }
 
     // Returns a valid Ref<T> if we can Promote the underlying WeakRef. Returns nullptr otherwise.
+    // Lookups only take a shared lock on the shard of the object, so concurrent lookups, including
+    // lookups of the same object, do not serialize.
     Ref<RefCountedT> Find(RefCountedT* blueprint) {
-        return WithLockAndCleanup([&]() -> Ref<RefCountedT> {
-            auto it = mCache.find(blueprint);
-            if (it != mCache.end()) {
+        Shard& shard = GetShard(typename CacheKeyFuncs::HashFunc()(blueprint));
+        return WithLockAndCleanup<std::shared_lock>(shard, [&]() -> Ref<RefCountedT> {
+            auto it = shard.cache.find(blueprint);
+            if (it != shard.cache.end()) {
                 return it->weakRef.Promote();
             }
             return nullptr;
@@ -190,10 +194,11 @@ class ContentLessObjectCache {
     // modify the cache. Since Erase never Promotes any WeakRefs, it does not need to be wrapped by
     // a WithLockAndCleanup, and a simple lock is enough.
     void Erase(RefCountedT* obj) {
+        Shard& shard = GetShard(typename CacheKeyFuncs::HashFunc()(obj));
         size_t count;
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            count = mCache.erase(detail::ForErase<RefCountedT>(obj));
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            count = shard.cache.erase(detail::ForErase<RefCountedT>(obj));
         }
         if (count == 0) {
             return;
@@ -203,43 +208,75 @@ class ContentLessObjectCache {
 
     // Returns true iff the cache is empty.
     bool Empty() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mCache.empty();
+        for (Shard& shard : mShards) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            if (!shard.cache.empty()) {
+                return false;
+            }
+        }
+        return true;
     }
 
   private:
     friend struct CacheKeyFuncs::EqualityFunc;
 
-    void TrackTemporaryRef(Ref<RefCountedT> ref) { mTemporaryRefs->push_back(std::move(ref)); }
-    template <typename F>
-    auto WithLockAndCleanup(F func) {
+    using TemporaryRefs = absl::InlinedVector<Ref<RefCountedT>, 4>;
+
+    // The cache is split in independently locked shards selected from the hash of the objects so
+    // that insertions of unrelated objects from multiple threads don't contend on a single lock.
+    static constexpr size_t kShardCountLog2 = 4;
+    static constexpr size_t kShardCount = size_t(1) << kShardCountLog2;
+
+    // Shards are aligned to a cache line to avoid false sharing between the shard mutexes.
+    struct alignas(64) Shard {
+        std::shared_mutex mutex;
+        absl::flat_hash_set<detail::WeakRefAndHash<RefCountedT>,
+                            typename CacheKeyFuncs::HashFunc,
+                            typename CacheKeyFuncs::EqualityFunc>
+            cache;
+    };
+
+    Shard& GetShard(size_t hash) {
+        // The low bits of the hash are used by the hash set to find the slot, so the shard index
+        // is taken from the high bits of a Fibonacci hash to avoid correlating the two.
+        uint64_t mixed = static_cast<uint64_t>(hash) * uint64_t(0x9E3779B97F4A7C15);
+        return mShards[mixed >> (64 - kShardCountLog2)];
+    }
+
+    // Each locked operation points the thread's temporary Refs to an InlinedVector that owns the
+    // Refs that are by-products of Promotes inside the EqualityFunc. These Refs need to outlive the
+    // EqualityFunc calls because otherwise, they could be the last living Ref of the object
+    // resulting in a re-entrant Erase call that deadlocks on the shard mutex. They are tracked per
+    // thread since multiple threads may be doing lookups in the same shard under a shared lock.
+    // Absl should make fewer than 1 equality checks per set operation, so a InlinedVector of length
+    // 4 should be sufficient for most cases. See dawn:1993 for more details.
+    static TemporaryRefs*& GetTemporaryRefs() {
+        thread_local TemporaryRefs* tlTemporaryRefs = nullptr;
+        return tlTemporaryRefs;
+    }
+    static void TrackTemporaryRef(Ref<RefCountedT> ref) {
+        DAWN_ASSERT(GetTemporaryRefs() != nullptr);
+        GetTemporaryRefs()->push_back(std::move(ref));
+    }
+
+    template <template <typename> class Lock, typename F>
+    auto WithLockAndCleanup(Shard& shard, F func) {
         using RetType = decltype(func());
         RetType result;
 
         // Creates and owns a temporary InlinedVector that we point to internally to track Refs.
-        absl::InlinedVector<Ref<RefCountedT>, 4> temps;
+        TemporaryRefs temps;
         {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mTemporaryRefs = &temps;
+            Lock<std::shared_mutex> lock(shard.mutex);
+            TemporaryRefs* previousTemps = GetTemporaryRefs();
+            GetTemporaryRefs() = &temps;
             result = func();
-            mTemporaryRefs = nullptr;
+            GetTemporaryRefs() = previousTemps;
         }
         return result;
     }
 
-    std::mutex mMutex;
-    absl::flat_hash_set<detail::WeakRefAndHash<RefCountedT>,
-                        typename CacheKeyFuncs::HashFunc,
-                        typename CacheKeyFuncs::EqualityFunc>
-        mCache;
-
-    // The cache has a pointer to a InlinedVector of temporary Refs that are by-products of Promotes
-    // inside the EqualityFunc. These Refs need to outlive the EqualityFunc calls because otherwise,
-    // they could be the last living Ref of the object resulting in a re-entrant Erase call that
-    // deadlocks on the mutex.
-    // Absl should make fewer than 1 equality checks per set operation, so a InlinedVector of length
-    // 4 should be sufficient for most cases. See dawn:1993 for more details.
-    raw_ptr<absl::InlinedVector<Ref<RefCountedT>, 4>> mTemporaryRefs = nullptr;
+    std::array<Shard, kShardCount> mShards;
 };
 
 }  // namespace dawn
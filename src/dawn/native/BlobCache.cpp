@@ -28,6 +28,8 @@
 #include "dawn/native/BlobCache.h"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Version_autogen.h"
@@ -40,14 +42,36 @@ namespace dawn::native {
 BlobCache::BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc)
     : mLoadFunction(desc.loadDataFunction),
       mStoreFunction(desc.storeDataFunction),
-      mFunctionUserdata(desc.functionUserdata) {}
+      mFunctionUserdata(desc.functionUserdata),
+      mMemoryCacheCapacity(desc.memoryCacheSize) {}
 
 Blob BlobCache::Load(const CacheKey& key) {
-    std::lock_guard<std::mutex> lock(mMutex);
-    return LoadInternal(key);
+    if (mMemoryCacheCapacity > 0) {
+        std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+        Blob blob;
+        if (LoadFromMemoryCache(key, &blob)) {
+            return blob;
+        }
+    }
+
+    Blob blob;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        blob = LoadInternal(key);
+    }
+    if (mMemoryCacheCapacity > 0 && !blob.Empty()) {
+        std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+        StoreInMemoryCache(key, blob.Size(), blob.Data());
+    }
+    return blob;
 }
 
 void BlobCache::Store(const CacheKey& key, size_t valueSize, const void* value) {
+    if (mMemoryCacheCapacity > 0) {
+        std::lock_guard<std::mutex> lock(mMemoryCacheMutex);
+        StoreInMemoryCache(key, valueSize, value);
+    }
+
     std::lock_guard<std::mutex> lock(mMutex);
     StoreInternal(key, valueSize, value);
 }
@@ -84,6 +108,62 @@ void BlobCache::StoreInternal(const CacheKey& key, size_t valueSize, const void*
     mStoreFunction(key.data(), key.size(), value, valueSize, mFunctionUserdata);
 }
 
+bool BlobCache::LoadFromMemoryCache(const CacheKey& key, Blob* blob) {
+    DAWN_ASSERT(ValidateCacheKey(key));
+    auto it = mMemoryCacheIndex.find(
+        std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+    if (it == mMemoryCacheIndex.end()) {
+        return false;
+    }
+
+    // Move the entry to the front of the list to mark it as the most recently used.
+    mMemoryCacheEntries.splice(mMemoryCacheEntries.begin(), mMemoryCacheEntries, it->second);
+
+    const std::vector<uint8_t>& value = it->second->value;
+    *blob = CreateBlob(value.size());
+    memcpy(blob->Data(), value.data(), value.size());
+    return true;
+}
+
+void BlobCache::StoreInMemoryCache(const CacheKey& key, size_t valueSize, const void* value) {
+    DAWN_ASSERT(ValidateCacheKey(key));
+    DAWN_ASSERT(value != nullptr);
+    DAWN_ASSERT(valueSize > 0);
+    const size_t entrySize = key.size() + valueSize;
+    if (entrySize > mMemoryCacheCapacity) {
+        // The entry would evict everything else and still not fit, skip it.
+        return;
+    }
+
+    std::string_view keyView(reinterpret_cast<const char*>(key.data()), key.size());
+    auto it = mMemoryCacheIndex.find(keyView);
+    if (it != mMemoryCacheIndex.end()) {
+        mMemoryCacheSize -= it->second->key.size() + it->second->value.size();
+        mMemoryCacheEntries.erase(it->second);
+        mMemoryCacheIndex.erase(it);
+    }
+
+    // Evict the least recently used entries until the new entry fits.
+    while (mMemoryCacheSize + entrySize > mMemoryCacheCapacity) {
+        DAWN_ASSERT(!mMemoryCacheEntries.empty());
+        const MemoryCacheEntry& lru = mMemoryCacheEntries.back();
+        mMemoryCacheIndex.erase(
+            std::string_view(reinterpret_cast<const char*>(lru.key.data()), lru.key.size()));
+        mMemoryCacheSize -= lru.key.size() + lru.value.size();
+        mMemoryCacheEntries.pop_back();
+    }
+
+    const uint8_t* valueBytes = static_cast<const uint8_t*>(value);
+    mMemoryCacheEntries.push_front(
+        {std::vector<uint8_t>(key.begin(), key.end()),
+         std::vector<uint8_t>(valueBytes, valueBytes + valueSize)});
+    const MemoryCacheEntry& entry = mMemoryCacheEntries.front();
+    mMemoryCacheIndex.emplace(
+        std::string_view(reinterpret_cast<const char*>(entry.key.data()), entry.key.size()),
+        mMemoryCacheEntries.begin());
+    mMemoryCacheSize += entrySize;
+}
+
 bool BlobCache::ValidateCacheKey(const CacheKey& key) {
     return std::search(key.begin(), key.end(), kDawnVersion.begin(), kDawnVersion.end()) !=
            key.end();
@@ -28,8 +28,13 @@
 #ifndef SRC_DAWN_NATIVE_BLOBCACHE_H_
 #define SRC_DAWN_NATIVE_BLOBCACHE_H_
 
+#include <cstdint>
+#include <list>
 #include <mutex>
+#include <string_view>
+#include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "dawn/common/Platform.h"
 #include "dawn/native/Blob.h"
 #include "dawn/native/CacheResult.h"
@@ -45,6 +50,9 @@ class CacheKey;
 class InstanceBase;
 
 // This class should always be thread-safe because it may be called asynchronously.
+// When a memory cache size is provided, the most recently used blobs are kept in a bounded
+// in-process LRU in front of the load/store functions so that repeated loads of hot entries don't
+// go through the embedder's callbacks.
 class BlobCache {
   public:
     explicit BlobCache(const dawn::native::DawnCacheDeviceDescriptor& desc);
@@ -71,16 +79,36 @@ class BlobCache {
     Blob LoadInternal(const CacheKey& key);
     void StoreInternal(const CacheKey& key, size_t valueSize, const void* value);
 
+    // Helpers for the in-memory tier. They must be called with `mMemoryCacheMutex` held.
+    bool LoadFromMemoryCache(const CacheKey& key, Blob* blob);
+    void StoreInMemoryCache(const CacheKey& key, size_t valueSize, const void* value);
+
     // Validates the cache key for this version of Dawn. At the moment, this is naively checking
     // that the cache key contains the dawn version string in it.
     bool ValidateCacheKey(const CacheKey& key);
 
-    // Protects thread safety of access to mCache.
+    // Protects thread safety of calls to the load and store functions.
     std::mutex mMutex;
     // TODO(https://crbug.com/dawn/2365): Convert these members to `raw_ptr`.
     RAW_PTR_EXCLUSION WGPUDawnLoadCacheDataFunction mLoadFunction;
     RAW_PTR_EXCLUSION WGPUDawnStoreCacheDataFunction mStoreFunction;
     RAW_PTR_EXCLUSION void* mFunctionUserdata;
+
+    // In-memory LRU tier, ordered from most to least recently used. The index points into the list
+    // nodes which own the key and value bytes and stay stable as entries move around the list.
+    struct MemoryCacheEntry {
+        std::vector<uint8_t> key;
+        std::vector<uint8_t> value;
+    };
+    using MemoryCacheList = std::list<MemoryCacheEntry>;
+
+    // Protects thread safety of access to the in-memory tier. It is separate from `mMutex` so that
+    // hits don't wait on slow load or store functions.
+    std::mutex mMemoryCacheMutex;
+    const size_t mMemoryCacheCapacity;
+    size_t mMemoryCacheSize = 0;
+    MemoryCacheList mMemoryCacheEntries;
+    absl::flat_hash_map<std::string_view, MemoryCacheList::iterator> mMemoryCacheIndex;
 };
 
 }  // namespace dawn::native
@@ -28,15 +28,132 @@
 #include "dawn/native/CommandAllocator.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <climits>
 #include <cstdlib>
 #include <utility>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Math.h"
+#include "dawn/native/DawnNative.h"
 
 namespace dawn::native {
 
+namespace {
+
+// Blocks of these sizes are kept in a per-thread free list when released so that recording
+// command buffers in a loop doesn't hit the system allocator for every encoder. The sizes match
+// the doubling sequence of CommandAllocator::GetNewBlock.
+constexpr std::array<size_t, 3> kBlockSizeClasses = {4096, 8192, 16384};
+// Upper bound on the number of cached blocks per size class and per thread, so that a burst of
+// large command buffers doesn't pin memory forever.
+constexpr size_t kMaxCachedBlocksPerSizeClass = 8;
+
+std::atomic<uint64_t> gBlocksAllocated = 0;
+std::atomic<uint64_t> gBlocksRecycled = 0;
+std::atomic<uint64_t> gBytesAllocated = 0;
+
+// Returns the index of the size class for |size|, or kBlockSizeClasses.size() if it has none.
+size_t SizeClassIndex(size_t size) {
+    for (size_t i = 0; i < kBlockSizeClasses.size(); i++) {
+        if (kBlockSizeClasses[i] == size) {
+            return i;
+        }
+    }
+    return kBlockSizeClasses.size();
+}
+
+// Returns the smallest size class that fits |size|, or the largest size class if none does.
+size_t RoundUpToSizeClass(size_t size) {
+    for (size_t sizeClass : kBlockSizeClasses) {
+        if (size <= sizeClass) {
+            return sizeClass;
+        }
+    }
+    return kBlockSizeClasses.back();
+}
+
+struct BlockCache {
+    ~BlockCache();
+
+    std::array<std::vector<std::unique_ptr<char[]>>, kBlockSizeClasses.size()> freeBlocks;
+    // Decaying estimate of how much memory the last command encoders on this thread used. It is
+    // used to pick the size of the first block of the next encoder.
+    size_t recentEncoderSize = 0;
+};
+
+// Set when the thread's cache has been destroyed so that blocks released later during thread
+// teardown are freed directly instead of touching a dead object.
+thread_local bool tlBlockCacheDestroyed = false;
+
+BlockCache::~BlockCache() {
+    tlBlockCacheDestroyed = true;
+}
+
+BlockCache* GetBlockCache() {
+    thread_local BlockCache tlBlockCache;
+    if (DAWN_UNLIKELY(tlBlockCacheDestroyed)) {
+        return nullptr;
+    }
+    return &tlBlockCache;
+}
+
+std::unique_ptr<char[]> AcquireBlock(size_t size) {
+    size_t sizeClass = SizeClassIndex(size);
+    if (sizeClass < kBlockSizeClasses.size()) {
+        BlockCache* cache = GetBlockCache();
+        if (cache != nullptr && !cache->freeBlocks[sizeClass].empty()) {
+            std::unique_ptr<char[]> block = std::move(cache->freeBlocks[sizeClass].back());
+            cache->freeBlocks[sizeClass].pop_back();
+            gBlocksRecycled.fetch_add(1, std::memory_order_relaxed);
+            return block;
+        }
+    }
+
+    auto block = std::unique_ptr<char[]>(new (std::nothrow) char[size]);
+    if (block != nullptr) {
+        gBlocksAllocated.fetch_add(1, std::memory_order_relaxed);
+        gBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    }
+    return block;
+}
+
+void RecordEncoderSize(size_t size) {
+    if (BlockCache* cache = GetBlockCache()) {
+        cache->recentEncoderSize = std::max(size, cache->recentEncoderSize / 2);
+    }
+}
+
+size_t GetRecentEncoderSize() {
+    BlockCache* cache = GetBlockCache();
+    return cache != nullptr ? cache->recentEncoderSize : 0;
+}
+
+}  // namespace
+
+CommandAllocatorCounters GetCommandAllocatorCountersForTesting() {
+    CommandAllocatorCounters counters;
+    counters.blocksAllocated = gBlocksAllocated.load(std::memory_order_relaxed);
+    counters.blocksRecycled = gBlocksRecycled.load(std::memory_order_relaxed);
+    counters.bytesAllocated = gBytesAllocated.load(std::memory_order_relaxed);
+    return counters;
+}
+
+void ReleaseCommandBlocks(CommandBlocks* blocks) {
+    BlockCache* cache = blocks->empty() ? nullptr : GetBlockCache();
+    if (cache != nullptr) {
+        for (BlockDef& block : *blocks) {
+            size_t sizeClass = SizeClassIndex(block.size);
+            if (sizeClass < kBlockSizeClasses.size() &&
+                cache->freeBlocks[sizeClass].size() < kMaxCachedBlocksPerSizeClass) {
+                cache->freeBlocks[sizeClass].push_back(std::move(block.block));
+            }
+        }
+    }
+    blocks->clear();
+}
+
 // TODO(cwallez@chromium.org): figure out a way to have more type safety for the iterator
 
 CommandIterator::CommandIterator() {
@@ -71,7 +188,7 @@ CommandIterator::CommandIterator(CommandAllocator allocator) : mBlocks(allocator
 
 void CommandIterator::AcquireCommandBlocks(std::vector<CommandAllocator> allocators) {
     DAWN_ASSERT(IsEmpty());
-    mBlocks.clear();
+    ReleaseCommandBlocks(&mBlocks);
     for (CommandAllocator& allocator : allocators) {
         CommandBlocks blocks = allocator.AcquireBlocks();
         if (!blocks.empty()) {
@@ -113,7 +230,7 @@ void CommandIterator::MakeEmptyAsDataWasDestroyed() {
     }
 
     mCurrentPtr = reinterpret_cast<char*>(&mEndOfBlock);
-    mBlocks.clear();
+    ReleaseCommandBlocks(&mBlocks);
     Reset();
     DAWN_ASSERT(IsEmpty());
 }
@@ -130,7 +247,8 @@ bool CommandIterator::IsEmpty() const {
 //  - Be able to optimize allocation to one block, for command buffers expected to live long to
 //    avoid cache misses
 //  - Better block allocation, maybe have Dawn API to say command buffer is going to have size
-//    close to another
+//    close to another (partially done by sizing the first block from the recent encoders on the
+//    thread)
 
 CommandAllocator::CommandAllocator() {
     ResetPointers();
@@ -166,7 +284,7 @@ CommandAllocator& CommandAllocator::operator=(CommandAllocator&& other) {
 
 void CommandAllocator::Reset() {
     ResetPointers();
-    mBlocks.clear();
+    ReleaseCommandBlocks(&mBlocks);
     mLastAllocationSize = kDefaultBaseAllocationSize;
 }
 
@@ -180,6 +298,12 @@ CommandBlocks&& CommandAllocator::AcquireBlocks() {
     DAWN_ASSERT(mCurrentPtr + sizeof(uint32_t) <= mEndPtr);
     *reinterpret_cast<uint32_t*>(mCurrentPtr) = detail::kEndOfBlock;
 
+    size_t usedSize = 0;
+    for (const BlockDef& block : mBlocks) {
+        usedSize += block.size;
+    }
+    RecordEncoderSize(usedSize);
+
     mCurrentPtr = nullptr;
     mEndPtr = nullptr;
     return std::move(mBlocks);
@@ -209,10 +333,27 @@ char* CommandAllocator::AllocateInNewBlock(uint32_t commandId,
 }
 
 bool CommandAllocator::GetNewBlock(size_t minimumSize) {
+    static_assert(kBlockSizeClasses.back() == kMaxBlockSizeClass);
+    static_assert(kBlockSizeClasses.front() == 2 * kDefaultBaseAllocationSize);
+
+    // The first block is sized from what recent encoders on this thread needed so that
+    // encoders recording the same kind of work every frame don't regrow block by block.
+    if (mBlocks.empty()) {
+        mLastAllocationSize =
+            std::max(kDefaultBaseAllocationSize, RoundUpToSizeClass(GetRecentEncoderSize()) / 2);
+    }
+
     // Allocate blocks doubling sizes each time, to a maximum of 16k (or at least minimumSize).
-    mLastAllocationSize = std::max(minimumSize, std::min(mLastAllocationSize * 2, size_t(16384)));
+    // Requests that fit in a size class are rounded up to it so that the block can be recycled.
+    mLastAllocationSize = std::min(mLastAllocationSize * 2, kMaxBlockSizeClass);
+    if (minimumSize > mLastAllocationSize) {
+        mLastAllocationSize = RoundUpToSizeClass(minimumSize);
+        if (mLastAllocationSize < minimumSize) {
+            mLastAllocationSize = minimumSize;
+        }
+    }
 
-    auto block = std::unique_ptr<char[]>(new (std::nothrow) char[mLastAllocationSize]);
+    auto block = AcquireBlock(mLastAllocationSize);
     if (DAWN_UNLIKELY(block == nullptr)) {
         return false;
     }
@@ -76,6 +76,11 @@ struct BlockDef {
 };
 using CommandBlocks = std::vector<BlockDef>;
 
+// Blocks are recycled through a small per-thread cache instead of going back to the system
+// allocator every time a command buffer is destroyed, see GetCommandAllocatorCountersForTesting.
+// Returns the blocks to the calling thread's cache (or frees them) and clears |blocks|.
+void ReleaseCommandBlocks(CommandBlocks* blocks);
+
 namespace detail {
 constexpr uint32_t kEndOfBlock = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kAdditionalData = std::numeric_limits<uint32_t>::max() - 1;
@@ -219,6 +224,9 @@ class CommandAllocator : public NonCopyable {
     // The default value of mLastAllocationSize.
     static constexpr size_t kDefaultBaseAllocationSize = 2048;
 
+    // Blocks grow by doubling up to this size (unless a single command needs more).
+    static constexpr size_t kMaxBlockSizeClass = 16384;
+
     friend CommandIterator;
     CommandBlocks&& AcquireBlocks();
 
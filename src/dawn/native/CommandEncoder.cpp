@@ -985,6 +985,29 @@ bool ShouldUseT2B2TForT2T(const DeviceBase* device,
     return false;
 }
 
+// Returns true if beginning a render pass with |descriptor| might run one of the workarounds of
+// ClearWithDrawHelper or RenderPassWorkaroundsHelper. These create internal resources and must
+// run with the device locked. This is conservative and doesn't depend on the descriptor being
+// valid.
+bool RenderPassWorkaroundsMayCreateResources(const DeviceBase* device,
+                                             const RenderPassDescriptor* descriptor) {
+    if (device->IsToggleEnabled(Toggle::ClearColorWithDraw) ||
+        device->IsToggleEnabled(Toggle::ApplyClearBigIntegerColorValueWithDraw) ||
+        device->IsToggleEnabled(Toggle::AlwaysResolveIntoZeroLevelAndLayer) ||
+        device->IsToggleEnabled(Toggle::ResolveMultipleAttachmentInSeparatePasses)) {
+        return true;
+    }
+    if (descriptor == nullptr || descriptor->colorAttachments == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < descriptor->colorAttachmentCount; ++i) {
+        if (descriptor->colorAttachments[i].loadOp == wgpu::LoadOp::ExpandResolveTexture) {
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 Color ClampClearColorValueToLegalRange(const Color& originalColor, const Format& format) {
@@ -1100,15 +1123,13 @@ void CommandEncoder::TrackQueryAvailability(QuerySetBase* querySet, uint32_t que
 // Implementation of the API's command recording methods
 
 ComputePassEncoder* CommandEncoder::APIBeginComputePass(const ComputePassDescriptor* descriptor) {
-    // This function will create new object, need to lock the Device.
-    auto deviceLock(GetDevice()->GetScopedLock());
-
+    // Beginning a compute pass only touches the state of this encoder and the thread-safe object
+    // tracking of the device, so the device doesn't need to be locked.
     return ReturnToAPI(BeginComputePass(descriptor));
 }
 
 Ref<ComputePassEncoder> CommandEncoder::BeginComputePass(const ComputePassDescriptor* descriptor) {
     DeviceBase* device = GetDevice();
-    DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
 
     bool success = mEncodingContext.TryEncode(
         this,
@@ -1160,15 +1181,20 @@ Ref<ComputePassEncoder> CommandEncoder::BeginComputePass(const ComputePassDescri
 }
 
 RenderPassEncoder* CommandEncoder::APIBeginRenderPass(const RenderPassDescriptor* descriptor) {
-    // This function will create new object, need to lock the Device.
-    auto deviceLock(GetDevice()->GetScopedLock());
+    // Encoders on different threads can begin render passes concurrently unless one of the render
+    // pass workarounds has to create resources, in which case the device needs to be locked.
+    if (!RenderPassWorkaroundsMayCreateResources(GetDevice(), descriptor)) {
+        return ReturnToAPI(BeginRenderPass(descriptor));
+    }
 
+    auto deviceLock(GetDevice()->GetScopedLock());
     return ReturnToAPI(BeginRenderPass(descriptor));
 }
 
 Ref<RenderPassEncoder> CommandEncoder::BeginRenderPass(const RenderPassDescriptor* rawDescriptor) {
     DeviceBase* device = GetDevice();
-    DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
+    DAWN_ASSERT(!RenderPassWorkaroundsMayCreateResources(device, rawDescriptor) ||
+                device->IsLockedByCurrentThreadIfNeeded());
 
     RenderPassResourceUsageTracker usageTracker;
 
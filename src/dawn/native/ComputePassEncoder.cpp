@@ -255,10 +255,6 @@ ResultOrError<std::pair<Ref<BufferBase>, uint64_t>>
 ComputePassEncoder::TransformIndirectDispatchBuffer(Ref<BufferBase> indirectBuffer,
                                                     uint64_t indirectOffset) {
     DeviceBase* device = GetDevice();
-    // This function creates new resources, need to lock the Device.
-    // TODO(crbug.com/dawn/1618): In future, all temp resources should be created at Command Submit
-    // time, so the locking would be removed from here at that point.
-    auto deviceLock(GetDevice()->GetScopedLock());
 
     const bool shouldDuplicateNumWorkgroups =
         device->ShouldDuplicateNumWorkgroupsForDispatchIndirect(
@@ -267,6 +263,11 @@ ComputePassEncoder::TransformIndirectDispatchBuffer(Ref<BufferBase> indirectBuff
         return std::make_pair(indirectBuffer, indirectOffset);
     }
 
+    // The rest of this function creates new resources, need to lock the Device.
+    // TODO(crbug.com/dawn/1618): In future, all temp resources should be created at Command Submit
+    // time, so the locking would be removed from here at that point.
+    auto deviceLock(GetDevice()->GetScopedLock());
+
     // Save the previous command buffer state so it can be restored after the
     // validation inserts additional commands.
     CommandBufferStateTracker previousState = mCommandBufferState;
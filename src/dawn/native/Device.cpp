@@ -414,6 +414,7 @@ DeviceBase::DeviceBase(AdapterBase* adapter,
         cacheDesc.loadDataFunction = nullptr;
         cacheDesc.storeDataFunction = nullptr;
         cacheDesc.functionUserdata = nullptr;
+        cacheDesc.memoryCacheSize = 0;
     }
     mBlobCache = std::make_unique<BlobCache>(cacheDesc);
 
@@ -1905,7 +1906,8 @@ void DeviceBase::IncrementLazyClearCountForTesting() {
 }
 
 void DeviceBase::EmitWarningOnce(const std::string& message) {
-    if (mWarnings.insert(message).second) {
+    bool inserted = mWarnings.Use([&](auto warnings) { return warnings->insert(message).second; });
+    if (inserted) {
         this->EmitLog(WGPULoggingType_Warning, message.c_str());
     }
 }
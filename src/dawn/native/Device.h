@@ -38,6 +38,7 @@
 #include "absl/container/flat_hash_set.h"
 #include "dawn/common/ContentLessObjectCache.h"
 #include "dawn/common/Mutex.h"
+#include "dawn/common/MutexProtected.h"
 #include "dawn/common/NonMovable.h"
 #include "dawn/common/StackAllocated.h"
 #include "dawn/native/CacheKey.h"
@@ -576,7 +577,9 @@ class DeviceBase : public ErrorSink, public RefCountedWithExternalCount {
 
     std::atomic<uint32_t> mEmittedCompilationLogCount = 0;
 
-    absl::flat_hash_set<std::string> mWarnings;
+    // Encoders validate commands without locking the device, so warnings can be emitted from
+    // multiple threads concurrently.
+    MutexProtected<absl::flat_hash_set<std::string>> mWarnings;
 
     State mState = State::BeingCreated;
 
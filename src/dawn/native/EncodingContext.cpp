@@ -59,6 +59,7 @@ void EncodingContext::Destroy() {
     if (!IsFinished()) {
         HandleError(DAWN_VALIDATION_ERROR("Destroyed encoder cannot be finished."));
     }
+    mIndirectDrawValidationCache.Clear();
     mDestroyed = true;
     mCurrentEncoder = nullptr;
 }
@@ -116,6 +117,11 @@ void EncodingContext::WillBeginRenderPass() {
         // any necessary validation or duplication commands. To support this we commit any
         // current commands now, so that the impending BeginRenderPassCmd starts in a fresh
         // CommandAllocator.
+        // Commands encoded since the previous render pass may write to the indirect buffers, so
+        // the parameters validated for previous render passes can't be reused anymore.
+        if (!mPendingCommands.IsEmpty()) {
+            mIndirectDrawValidationCache.Clear();
+        }
         CommitCommands(std::move(mPendingCommands));
     }
 }
@@ -147,16 +153,15 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
         //       so swap back the renderCommands to ensure that they are not leaked.
         CommandAllocator renderCommands = std::move(mPendingCommands);
 
-        // The below function might create new resources. Device must already be locked via
-        // renderpassEncoder's APIEnd().
+        // The below function might create new resources when there are indirect draws to
+        // validate. Device must already be locked via renderpassEncoder's APIEnd() in that case.
         // TODO(crbug.com/dawn/1618): In future, all temp resources should be created at
         // Command Submit time, so the locking would be removed from here at that point.
         {
-            DAWN_ASSERT(mDevice->IsLockedByCurrentThreadIfNeeded());
-
             DAWN_TRY_WITH_CLEANUP(
                 EncodeIndirectDrawValidationCommands(mDevice, commandEncoder, &usageTracker,
-                                                     &indirectDrawMetadata),
+                                                     &indirectDrawMetadata,
+                                                     &mIndirectDrawValidationCache),
                 { mPendingCommands = std::move(renderCommands); });
         }
 
@@ -165,6 +170,7 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
     }
 
     mRenderPassUsages.push_back(usageTracker.AcquireResourceUsage());
+    mIndirectDrawValidationCache.ClearIfAnyIndirectBufferWritten(mRenderPassUsages.back());
     return {};
 }
 
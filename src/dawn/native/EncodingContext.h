@@ -37,6 +37,7 @@
 #include "dawn/native/Error.h"
 #include "dawn/native/ErrorData.h"
 #include "dawn/native/IndirectDrawMetadata.h"
+#include "dawn/native/IndirectDrawValidationEncoder.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/PassResourceUsageTracker.h"
 #include "dawn/native/dawn_platform.h"
@@ -187,6 +188,8 @@ class EncodingContext {
     bool mWereComputePassUsagesAcquired = false;
 
     CommandAllocator mPendingCommands;
+    // Validated indirect draw parameters reused by the render passes of this encoder only.
+    IndirectDrawValidationCache mIndirectDrawValidationCache;
 
     std::vector<CommandAllocator> mAllocators;
     CommandIterator mIterator;
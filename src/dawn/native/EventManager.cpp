@@ -145,6 +145,35 @@ class SystemEventAndReadyStateIterator {
     WrappedIter mWrappedIt;
 };
 
+// Flushes the commands of `queue` if `waitSerial` hasn't been submitted yet, then waits at most
+// `timeout` for `waitSerial` to complete and updates the completed serial of the queue.
+// Returns true if the wait succeeded.
+ResultOrError<bool> UpdateQueueCompletedSerial(QueueBase* queue,
+                                               ExecutionSerial waitSerial,
+                                               Nanoseconds timeout) {
+    DeviceBase* device = queue->GetDevice();
+    bool success = false;
+    if (waitSerial > queue->GetLastSubmittedCommandSerial()) {
+        // Serial has not been submitted yet. Submit it now.
+        // TODO(dawn:1413): This doesn't need to be a full tick. It just needs to
+        // flush work up to `waitSerial`. This should be done after the
+        // ExecutionQueue / ExecutionContext refactor.
+        auto guard = device->GetScopedLock();
+        queue->ForceEventualFlushOfCommands();
+        DAWN_TRY(device->Tick());
+    }
+    // Check the completed serial.
+    if (queue->GetCompletedCommandSerial() < waitSerial) {
+        if (timeout > Nanoseconds(0)) {
+            // Wait on the serial if it hasn't passed yet.
+            DAWN_TRY_ASSIGN(success, queue->WaitForQueueSerial(waitSerial, timeout));
+        }
+        // Update completed serials.
+        DAWN_TRY(queue->CheckPassedSerials());
+    }
+    return success;
+}
+
 // Wait/poll the queue for futures in range [begin, end). `waitSerial` should be
 // the serial after which at least one future should be complete. All futures must
 // have completion data of type QueueAndSerial.
@@ -157,45 +186,25 @@ bool WaitQueueSerialsImpl(DeviceBase* device,
                           std::vector<TrackedFutureWaitInfo>::iterator end,
                           Nanoseconds timeout) {
     bool success = false;
-    if (device->ConsumedError([&]() -> MaybeError {
-            if (waitSerial > queue->GetLastSubmittedCommandSerial()) {
-                // Serial has not been submitted yet. Submit it now.
-                // TODO(dawn:1413): This doesn't need to be a full tick. It just needs to
-                // flush work up to `waitSerial`. This should be done after the
-                // ExecutionQueue / ExecutionContext refactor.
-                auto guard = device->GetScopedLock();
-                queue->ForceEventualFlushOfCommands();
-                DAWN_TRY(device->Tick());
-            }
-            // Check the completed serial.
-            ExecutionSerial completedSerial = queue->GetCompletedCommandSerial();
-            if (completedSerial < waitSerial) {
-                if (timeout > Nanoseconds(0)) {
-                    // Wait on the serial if it hasn't passed yet.
-                    DAWN_TRY_ASSIGN(success, queue->WaitForQueueSerial(waitSerial, timeout));
-                }
-                // Update completed serials.
-                DAWN_TRY(queue->CheckPassedSerials());
-                completedSerial = queue->GetCompletedCommandSerial();
-            }
-            // Poll futures for completion.
-            for (auto it = begin; it != end; ++it) {
-                ExecutionSerial serial =
-                    std::get<QueueAndSerial>(it->event->GetCompletionData()).completionSerial;
-                if (serial <= completedSerial) {
-                    success = true;
-                    it->ready = true;
-                }
-            }
-            return {};
-        }())) {
+    if (device->ConsumedError(UpdateQueueCompletedSerial(queue, waitSerial, timeout), &success)) {
         // There was an error. Pending submit may have failed or waiting for fences
         // may have lost the device. The device is lost inside ConsumedError.
         // Mark all futures as ready.
         for (auto it = begin; it != end; ++it) {
             it->ready = true;
         }
-        success = true;
+        return true;
+    }
+
+    // Poll futures for completion.
+    ExecutionSerial completedSerial = queue->GetCompletedCommandSerial();
+    for (auto it = begin; it != end; ++it) {
+        ExecutionSerial serial =
+            std::get<QueueAndSerial>(it->event->GetCompletionData()).completionSerial;
+        if (serial <= completedSerial) {
+            success = true;
+            it->ready = true;
+        }
     }
     return success;
 }
@@ -344,6 +353,64 @@ bool EventManager::IsShutDown() const {
     return mEvents.Use([](auto events) { return !events->has_value(); });
 }
 
+// static
+void EventManager::Track(TrackedEvents& tracked, FutureID futureID, Ref<TrackedEvent>&& event) {
+    if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
+        tracked.pollEventCount++;
+        const auto& completionData = event->GetCompletionData();
+        if (std::holds_alternative<Ref<SystemEvent>>(completionData)) {
+            tracked.systemPollEvents.insert(futureID);
+            if (std::get<Ref<SystemEvent>>(completionData)->IsProgressing()) {
+                tracked.progressingPollEventCount++;
+            }
+        } else {
+            const auto& queueAndSerial = std::get<QueueAndSerial>(completionData);
+            QueuePollEvents& queueEvents = tracked.queuePollEvents[queueAndSerial.queue.Get()];
+            if (queueEvents.queue == nullptr) {
+                queueEvents.queue = queueAndSerial.queue;
+            }
+            queueEvents.futures.Enqueue(futureID, queueAndSerial.completionSerial);
+            queueEvents.trackedCount++;
+            tracked.progressingPollEventCount++;
+        }
+    }
+    tracked.events.emplace(futureID, std::move(event));
+}
+
+// static
+Ref<EventManager::TrackedEvent> EventManager::Untrack(TrackedEvents& tracked,
+                                                      FutureID futureID) {
+    auto it = tracked.events.find(futureID);
+    if (it == tracked.events.end()) {
+        return nullptr;
+    }
+    Ref<TrackedEvent> event = std::move(it->second);
+    tracked.events.erase(it);
+
+    if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
+        tracked.pollEventCount--;
+        tracked.readyPollEvents.erase(futureID);
+        const auto& completionData = event->GetCompletionData();
+        if (std::holds_alternative<Ref<SystemEvent>>(completionData)) {
+            tracked.systemPollEvents.erase(futureID);
+            if (std::get<Ref<SystemEvent>>(completionData)->IsProgressing()) {
+                tracked.progressingPollEventCount--;
+            }
+        } else {
+            // The entry in QueuePollEvents::futures is left behind and skipped once its serial
+            // passes, unless the queue doesn't have any other tracked event.
+            auto queueIt =
+                tracked.queuePollEvents.find(std::get<QueueAndSerial>(completionData).queue.Get());
+            DAWN_ASSERT(queueIt != tracked.queuePollEvents.end());
+            if (--queueIt->second.trackedCount == 0) {
+                tracked.queuePollEvents.erase(queueIt);
+            }
+            tracked.progressingPollEventCount--;
+        }
+    }
+    return event;
+}
+
 FutureID EventManager::TrackEvent(Ref<TrackedEvent>&& event) {
     if (!ValidateCallbackMode(ToAPI(event->mCallbackMode))) {
         // TODO: crbug.com/42241407 - Update to use instance logging callback.
@@ -383,7 +450,7 @@ FutureID EventManager::TrackEvent(Ref<TrackedEvent>&& event) {
                                                               std::memory_order_acq_rel)) {
             }
         }
-        (*events)->emplace(futureID, std::move(event));
+        Track(**events, futureID, std::move(event));
     });
     return futureID;
 }
@@ -405,75 +472,112 @@ void EventManager::SetFutureReady(TrackedEvent* event) {
         return;
     }
 
-    // Handle spontaneous completion now.
-    if (event->mCallbackMode == wgpu::CallbackMode::AllowSpontaneous) {
-        mEvents.Use([&](auto events) {
-            if (!events->has_value()) {
-                return;
-            }
-            (*events)->erase(event->mFutureID);
-        });
-        event->EnsureComplete(EventCompletionType::Ready);
+    switch (event->mCallbackMode) {
+        case wgpu::CallbackMode::AllowSpontaneous:
+            // Handle spontaneous completion now.
+            mEvents.Use([&](auto events) {
+                if (!events->has_value()) {
+                    return;
+                }
+                Untrack(**events, event->mFutureID);
+            });
+            event->EnsureComplete(EventCompletionType::Ready);
+            break;
+        case wgpu::CallbackMode::AllowProcessEvents:
+            // Let the next ProcessEvents find the event without looking at all the others. Events
+            // that aren't tracked yet are found by polling instead.
+            mEvents.Use([&](auto events) {
+                if (!events->has_value() || !(*events)->events.contains(event->mFutureID)) {
+                    return;
+                }
+                (*events)->readyPollEvents.insert(event->mFutureID);
+            });
+            break;
+        case wgpu::CallbackMode::WaitAnyOnly:
+            break;
     }
 }
 
 bool EventManager::ProcessPollEvents() {
     DAWN_ASSERT(!IsShutDown());
 
-    std::vector<TrackedEvent::WaitRef> completable;
-    wgpu::WaitStatus waitStatus;
-    bool hasProgressingEvents = false;
-    auto hasIncompleteEvents = mEvents.Use([&](auto events) {
-        // Iterate all events and record poll events and spontaneous events since they are both
-        // allowed to be completed in the ProcessPoll call. Note that spontaneous events are allowed
-        // to trigger anywhere which is why we include them in the call.
-        std::vector<TrackedFutureWaitInfo> futures;
-        futures.reserve((*events)->size());
-        for (auto& [futureID, event] : **events) {
-            if (event->mCallbackMode != wgpu::CallbackMode::WaitAnyOnly) {
-                // Figure out if there are any progressing events. If we only have non-progressing
-                // events, we need to return false to indicate that there isn't any polling work to
-                // be done.
-                auto completionData = event->GetCompletionData();
-                if (std::holds_alternative<Ref<SystemEvent>>(completionData)) {
-                    hasProgressingEvents |=
-                        std::get<Ref<SystemEvent>>(completionData)->IsProgressing();
-                } else {
-                    hasProgressingEvents = true;
-                }
-
-                futures.push_back(
-                    TrackedFutureWaitInfo{futureID, TrackedEvent::WaitRef{event.Get()}, 0, false});
-            }
+    // Gather the lowest serial waited on for each queue. The completed serials of the queues are
+    // updated without holding the lock since doing so may lose the device, which calls
+    // SetFutureReady for the device lost event.
+    std::vector<std::pair<Ref<QueueBase>, ExecutionSerial>> queueSerials;
+    mEvents.Use([&](auto events) {
+        for (auto& [_, queueEvents] : (*events)->queuePollEvents) {
+            DAWN_ASSERT(!queueEvents.futures.Empty());
+            queueSerials.emplace_back(queueEvents.queue, queueEvents.futures.FirstSerial());
         }
+    });
 
-        // If there wasn't anything to wait on, we can skip the wait and just return the end.
-        if (futures.size() == 0) {
-            return false;
+    // Replace each waited serial by the completed serial of its queue.
+    for (auto& [queue, serial] : queueSerials) {
+        bool unused;
+        if (queue->GetDevice()->ConsumedError(
+                UpdateQueueCompletedSerial(queue.Get(), serial, Nanoseconds(0)), &unused)) {
+            // There was an error and the device was lost inside ConsumedError. All the futures of
+            // the queue are ready.
+            serial = kMaxExecutionSerial;
+        } else {
+            serial = queue->GetCompletedCommandSerial();
         }
+    }
 
-        waitStatus = WaitImpl(futures, Nanoseconds(0));
-        if (waitStatus == wgpu::WaitStatus::TimedOut) {
-            return true;
+    std::vector<TrackedFutureWaitInfo> completable;
+    bool hasProgressingEvents = false;
+    auto hasIncompleteEvents = mEvents.Use([&](auto events) {
+        TrackedEvents& tracked = **events;
+        // Note that spontaneous events are allowed to trigger anywhere which is why they are
+        // polled here too.
+        hasProgressingEvents = tracked.progressingPollEventCount > 0;
+
+        std::vector<FutureID> readyFutureIDs(tracked.readyPollEvents.begin(),
+                                             tracked.readyPollEvents.end());
+
+        // Gather the queue events whose serial passed. Only the events with the lowest serials are
+        // visited. Queues whose events were all completed elsewhere in the meantime are gone.
+        for (const auto& [queue, completedSerial] : queueSerials) {
+            auto queueIt = tracked.queuePollEvents.find(queue.Get());
+            if (queueIt == tracked.queuePollEvents.end()) {
+                continue;
+            }
+            QueuePollEvents& queueEvents = queueIt->second;
+            for (FutureID futureID : queueEvents.futures.IterateUpTo(completedSerial)) {
+                readyFutureIDs.push_back(futureID);
+            }
+            queueEvents.futures.ClearUpTo(completedSerial);
         }
-        DAWN_ASSERT(waitStatus == wgpu::WaitStatus::Success);
 
-        // Enforce callback ordering.
-        auto readyEnd = PrepareReadyCallbacks(futures);
+        // Poll the system events.
+        for (FutureID futureID : tracked.systemPollEvents) {
+            const auto& completionData = tracked.events.at(futureID)->GetCompletionData();
+            if (std::get<Ref<SystemEvent>>(completionData)->IsSignaled()) {
+                readyFutureIDs.push_back(futureID);
+            }
+        }
 
-        // For all the futures we are about to complete, first ensure they're untracked.
-        for (auto it = futures.begin(); it != readyEnd; ++it) {
-            (*events)->erase(it->futureID);
-            completable.emplace_back(std::move(it->event));
+        // Untrack the futures we are about to complete. Some may have been gathered twice or
+        // completed elsewhere already.
+        for (FutureID futureID : readyFutureIDs) {
+            Ref<TrackedEvent> event = Untrack(tracked, futureID);
+            if (event != nullptr) {
+                completable.push_back(
+                    TrackedFutureWaitInfo{futureID, TrackedEvent::WaitRef{event.Get()}, 0, true});
+            }
         }
-        return readyEnd != futures.end();
+        return tracked.pollEventCount > 0;
     });
 
+    // Enforce callback ordering.
+    PrepareReadyCallbacks(completable);
+
     // Finally, call callbacks while comparing the last process event id with any new ones that may
     // have been created via the callbacks.
     FutureID lastProcessEventID = mLastProcessEventID.load(std::memory_order_acquire);
-    for (auto& event : completable) {
-        event->EnsureComplete(EventCompletionType::Ready);
+    for (auto& future : completable) {
+        future.event->EnsureComplete(EventCompletionType::Ready);
     }
     // Note that in the event of all progressing events completing, but there exists non-progressing
     // events, we will return true one extra time.
@@ -515,8 +619,8 @@ wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nano
             // same time (unless it's already completed).
 
             // Try to find the event.
-            auto it = (*events)->find(futureID);
-            if (it == (*events)->end()) {
+            auto it = (*events)->events.find(futureID);
+            if (it == (*events)->events.end()) {
                 infos[i].completed = true;
                 anyCompleted = true;
             } else {
@@ -548,7 +652,7 @@ wgpu::WaitStatus EventManager::WaitAny(size_t count, FutureWaitInfo* infos, Nano
     // something actually isn't tracked anymore (because it completed elsewhere while waiting.)
     mEvents.Use([&](auto events) {
         for (auto it = futures.begin(); it != readyEnd; ++it) {
-            (*events)->erase(it->futureID);
+            Untrack(**events, it->futureID);
         }
     });
 
@@ -33,12 +33,15 @@
 #include <mutex>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "dawn/common/FutureUtils.h"
 #include "dawn/common/MutexProtected.h"
 #include "dawn/common/NonMovable.h"
 #include "dawn/common/Ref.h"
+#include "dawn/common/SerialMap.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
@@ -80,6 +83,39 @@ class EventManager final : NonMovable {
                                            Nanoseconds timeout);
 
   private:
+    using EventMap = absl::flat_hash_map<FutureID, Ref<TrackedEvent>>;
+
+    // Poll events (the ones ProcessEvents is allowed to complete) waiting on a serial of `queue`,
+    // sorted by serial so that ProcessEvents only looks at the ones whose serial has passed.
+    struct QueuePollEvents {
+        Ref<QueueBase> queue;
+        SerialMap<ExecutionSerial, FutureID> futures;
+        // Number of entries in `futures` that are still tracked. Entries of futures that were
+        // completed by other means (WaitAny, SetFutureReady) are skipped when their serial passes.
+        size_t trackedCount = 0;
+    };
+
+    struct TrackedEvents {
+        // All tracked events, used to look up the futures passed to WaitAny.
+        EventMap events;
+
+        // Index of the poll events contained in `events`.
+        absl::flat_hash_map<QueueBase*, QueuePollEvents> queuePollEvents;
+        // SystemEvents may be signaled without going through SetFutureReady (e.g. by Metal's
+        // completion handlers) so ProcessEvents still checks each of them for completion.
+        absl::flat_hash_set<FutureID> systemPollEvents;
+        // Poll events made ready through SetFutureReady, so that ProcessEvents finds them without
+        // looking at all the others. Untrack removes them, so events completed by WaitAny aren't
+        // kept around until the next ProcessEvents.
+        absl::flat_hash_set<FutureID> readyPollEvents;
+        size_t pollEventCount = 0;
+        size_t progressingPollEventCount = 0;
+    };
+
+    // Add or remove an event from the TrackedEvents and its poll event index.
+    static void Track(TrackedEvents& tracked, FutureID futureID, Ref<TrackedEvent>&& event);
+    static Ref<TrackedEvent> Untrack(TrackedEvents& tracked, FutureID futureID);
+
     bool IsShutDown() const;
 
     bool mTimedWaitAnyEnable = false;
@@ -88,8 +124,7 @@ class EventManager final : NonMovable {
 
     // Freed once the user has dropped their last ref to the Instance, so can't call WaitAny or
     // ProcessEvents anymore. This breaks reference cycles.
-    using EventMap = absl::flat_hash_map<FutureID, Ref<TrackedEvent>>;
-    MutexProtected<std::optional<EventMap>> mEvents;
+    MutexProtected<std::optional<TrackedEvents>> mEvents;
 
     // Records last process event id in order to properly return whether or not there are still
     // events to process when we have re-entrant callbacks.
@@ -44,6 +44,7 @@
 #include "dawn/native/ComputePipeline.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/InternalPipelineStore.h"
+#include "dawn/native/PassResourceUsage.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/utils/WGPUHelpers.h"
 #include "partition_alloc/pointers/raw_ptr.h"
@@ -282,8 +283,70 @@ size_t GetBatchDataSize(uint32_t numDraws) {
     return sizeof(BatchInfo) + (numDraws * kIndirectDrawByteSize);
 }
 
+uint64_t GetOutputIndirectSize(const IndirectDrawMetadata::IndexedIndirectConfig& config) {
+    uint64_t outputIndirectSize = config.drawType == IndirectDrawMetadata::DrawType::Indexed
+                                      ? kDrawIndexedIndirectSize
+                                      : kDrawIndirectSize;
+    if (config.duplicateBaseVertexInstance) {
+        outputIndirectSize += 2 * sizeof(uint32_t);
+    }
+    return outputIndirectSize;
+}
+
 }  // namespace
 
+bool IndirectDrawValidationCache::Key::operator==(const Key& other) const {
+    return config == other.config && inputBufferOffset == other.inputBufferOffset &&
+           numIndexBufferElements == other.numIndexBufferElements &&
+           indexBufferOffsetInElements == other.indexBufferOffsetInElements;
+}
+
+IndirectDrawValidationCache::IndirectDrawValidationCache() = default;
+
+IndirectDrawValidationCache::~IndirectDrawValidationCache() = default;
+
+const IndirectDrawValidationCache::ValidatedParams* IndirectDrawValidationCache::Find(
+    const Key& key) const {
+    auto it = mValidatedParams.find(key);
+    if (it == mValidatedParams.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void IndirectDrawValidationCache::Add(const Key& key, BufferBase* buffer, uint64_t offset) {
+    mValidatedParams.emplace(key, ValidatedParams{buffer, offset});
+    mIndirectBuffers.insert(key.config.inputIndirectBufferPtr);
+}
+
+uint64_t IndirectDrawValidationCache::GetValidatedParamsEnd() const {
+    return mValidatedParamsEnd;
+}
+
+void IndirectDrawValidationCache::SetValidatedParamsEnd(uint64_t end) {
+    mValidatedParamsEnd = end;
+}
+
+void IndirectDrawValidationCache::Clear() {
+    mValidatedParams.clear();
+    mIndirectBuffers.clear();
+    mValidatedParamsEnd = 0;
+}
+
+void IndirectDrawValidationCache::ClearIfAnyIndirectBufferWritten(
+    const SyncScopeResourceUsage& usage) {
+    if (mIndirectBuffers.empty()) {
+        return;
+    }
+    for (size_t i = 0; i < usage.buffers.size(); ++i) {
+        if ((usage.bufferSyncInfos[i].usage & ~kReadOnlyBufferUsages) != 0 &&
+            mIndirectBuffers.contains(reinterpret_cast<uintptr_t>(usage.buffers[i]))) {
+            Clear();
+            return;
+        }
+    }
+}
+
 uint32_t ComputeMaxDrawCallsPerIndirectValidationBatch(const CombinedLimits& limits) {
     const uint64_t batchDrawCallLimitByDispatchSize =
         static_cast<uint64_t>(limits.v1.maxComputeWorkgroupsPerDimension) * kWorkgroupSize;
@@ -297,7 +360,15 @@ uint32_t ComputeMaxDrawCallsPerIndirectValidationBatch(const CombinedLimits& lim
 MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                                                 CommandEncoder* commandEncoder,
                                                 RenderPassResourceUsageTracker* usageTracker,
-                                                IndirectDrawMetadata* indirectDrawMetadata) {
+                                                IndirectDrawMetadata* indirectDrawMetadata,
+                                                IndirectDrawValidationCache* validationCache) {
+    IndirectDrawMetadata::IndexedIndirectBufferValidationInfoMap& bufferInfoMap =
+        *indirectDrawMetadata->GetIndexedIndirectBufferValidationInfo();
+    if (bufferInfoMap.empty()) {
+        // Nothing to validate. This is the common case and can run without the device lock.
+        return {};
+    }
+
     DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
     // Since encoding validation commands may create new objects, verify that the device is alive.
     // TODO(dawn:1199): This check is obsolete if device loss causes device.destroy().
@@ -306,7 +377,8 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     DAWN_TRY(device->ValidateIsAlive());
 
     struct Batch {
-        raw_ptr<const IndirectDrawMetadata::IndirectValidationBatch> metadata;
+        // The draws of the batch whose parameters aren't already validated.
+        std::vector<IndirectDrawMetadata::IndirectDraw> draws;
         uint64_t dataBufferOffset;
         uint64_t dataSize;
         uint64_t inputIndirectOffset;
@@ -326,18 +398,11 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
         std::vector<Batch> batches;
     };
 
-    // First stage is grouping all batches into passes. We try to pack as many batches into a
-    // single pass as possible. Batches can be grouped together as long as they're validating
-    // data from the same indirect buffer and draw type, but they may still be split into
-    // multiple passes if the number of draw calls in a pass would exceed some (very high)
-    // upper bound.
-    uint64_t outputParamsSize = 0;
-    std::vector<Pass> passes;
-    IndirectDrawMetadata::IndexedIndirectBufferValidationInfoMap& bufferInfoMap =
-        *indirectDrawMetadata->GetIndexedIndirectBufferValidationInfo();
-    if (bufferInfoMap.empty()) {
-        return {};
-    }
+    // A draw using the parameters validated for a previous draw of this render pass.
+    struct DuplicateDraw {
+        raw_ptr<DrawIndirectCmd> cmd;
+        uint64_t outputParamsOffset;
+    };
 
     const uint64_t maxStorageBufferBindingSize = device->GetLimits().v1.maxStorageBufferBindingSize;
     const uint32_t minStorageBufferOffsetAlignment =
@@ -346,31 +411,80 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     const bool applyIndexBufferOffsetToFirstIndex =
         device->ShouldApplyIndexBufferOffsetToFirstIndex();
 
+    // The validated parameters are written after those of the previous render passes of the
+    // command encoder so that they stay valid for reuse. When that could overflow the largest
+    // storage binding, the cached parameters are dropped and overwritten instead.
+    uint64_t maxOutputParamsSize = 0;
+    for (auto& [config, validationInfo] : bufferInfoMap) {
+        for (const IndirectDrawMetadata::IndirectValidationBatch& batch :
+             validationInfo.GetBatches()) {
+            maxOutputParamsSize += batch.draws.size() * GetOutputIndirectSize(config) +
+                                   minStorageBufferOffsetAlignment;
+        }
+    }
+    uint64_t outputParamsSize = validationCache->GetValidatedParamsEnd();
+    if (outputParamsSize + maxOutputParamsSize > maxStorageBufferBindingSize) {
+        validationCache->Clear();
+        outputParamsSize = 0;
+    }
+
+    // First stage is grouping all batches into passes. We try to pack as many batches into a
+    // single pass as possible. Batches can be grouped together as long as they're validating
+    // data from the same indirect buffer and draw type, but they may still be split into
+    // multiple passes if the number of draw calls in a pass would exceed some (very high)
+    // upper bound. Draws whose parameters were already validated for a previous render pass of
+    // the command encoder, or for a previous draw of this render pass, are not validated again.
+    std::vector<Pass> passes;
+    std::vector<DuplicateDraw> duplicateDraws;
+    absl::flat_hash_map<IndirectDrawValidationCache::Key, uint64_t> validatedParamsOffsets;
+
     for (auto& [config, validationInfo] : bufferInfoMap) {
         const uint64_t indirectDrawCommandSize =
             config.drawType == IndirectDrawMetadata::DrawType::Indexed ? kDrawIndexedIndirectSize
                                                                        : kDrawIndirectSize;
-
-        uint64_t outputIndirectSize = indirectDrawCommandSize;
-        if (config.duplicateBaseVertexInstance) {
-            outputIndirectSize += 2 * sizeof(uint32_t);
-        }
+        const uint64_t outputIndirectSize = GetOutputIndirectSize(config);
 
         for (const IndirectDrawMetadata::IndirectValidationBatch& batch :
              validationInfo.GetBatches()) {
+            Batch newBatch;
+            newBatch.outputParamsOffset = Align(outputParamsSize, minStorageBufferOffsetAlignment);
+
+            for (const IndirectDrawMetadata::IndirectDraw& draw : batch.draws) {
+                IndirectDrawValidationCache::Key key = {config, draw.inputBufferOffset,
+                                                        draw.numIndexBufferElements,
+                                                        draw.indexBufferOffsetInElements};
+                if (const auto* validated = validationCache->Find(key)) {
+                    draw.cmd->indirectBuffer = validated->buffer;
+                    draw.cmd->indirectOffset = validated->offset;
+                    usageTracker->BufferUsedAs(validated->buffer.Get(),
+                                               wgpu::BufferUsage::Indirect);
+                    continue;
+                }
+
+                uint64_t drawOutputParamsOffset =
+                    newBatch.outputParamsOffset + newBatch.draws.size() * outputIndirectSize;
+                auto [it, inserted] = validatedParamsOffsets.emplace(key, drawOutputParamsOffset);
+                if (!inserted) {
+                    duplicateDraws.push_back({draw.cmd, it->second});
+                    continue;
+                }
+                newBatch.draws.push_back(draw);
+            }
+
+            if (newBatch.draws.empty()) {
+                continue;
+            }
+
             const uint64_t minOffsetFromAlignedBoundary =
                 batch.minOffset % minStorageBufferOffsetAlignment;
             const uint64_t minOffsetAlignedDown = batch.minOffset - minOffsetFromAlignedBoundary;
 
-            Batch newBatch;
-            newBatch.metadata = &batch;
-            newBatch.dataSize = GetBatchDataSize(batch.draws.size());
+            newBatch.dataSize = GetBatchDataSize(newBatch.draws.size());
             newBatch.inputIndirectOffset = minOffsetAlignedDown;
             newBatch.inputIndirectSize =
                 batch.maxOffset + indirectDrawCommandSize - minOffsetAlignedDown;
 
-            newBatch.outputParamsSize = batch.draws.size() * outputIndirectSize;
-            newBatch.outputParamsOffset = Align(outputParamsSize, minStorageBufferOffsetAlignment);
+            newBatch.outputParamsSize = newBatch.draws.size() * outputIndirectSize;
             outputParamsSize = newBatch.outputParamsOffset + newBatch.outputParamsSize;
             if (outputParamsSize > maxStorageBufferBindingSize) {
                 return DAWN_INTERNAL_ERROR("Too many drawIndexedIndirect calls to validate");
@@ -388,7 +502,7 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                     // We can fit this batch in the current pass.
                     newBatch.dataBufferOffset = nextBatchDataOffset;
                     currentPass->batchDataSize = newPassBatchDataSize;
-                    currentPass->batches.push_back(newBatch);
+                    currentPass->batches.push_back(std::move(newBatch));
                     continue;
                 }
             }
@@ -400,7 +514,7 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
             newPass.inputIndirectBuffer = validationInfo.GetIndirectBuffer();
             newPass.drawType = config.drawType;
             newPass.batchDataSize = newBatch.dataSize;
-            newPass.batches.push_back(newBatch);
+            newPass.batches.push_back(std::move(newBatch));
             newPass.flags = 0;
             if (config.duplicateBaseVertexInstance) {
                 newPass.flags |= kDuplicateBaseVertexInstance;
@@ -422,6 +536,12 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
         }
     }
 
+    if (passes.empty()) {
+        // All the draws reuse parameters validated for previous render passes.
+        DAWN_ASSERT(duplicateDraws.empty());
+        return {};
+    }
+
     auto* const store = device->GetInternalPipelineStore();
     ScratchBuffer& outputParamsBuffer = store->scratchIndirectStorage;
     ScratchBuffer& batchDataBuffer = store->scratchStorage;
@@ -436,6 +556,15 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     // We swap the indirect buffer used so we need to explicitly add the usage.
     usageTracker->BufferUsedAs(outputParamsBuffer.GetBuffer(), wgpu::BufferUsage::Indirect);
 
+    for (const DuplicateDraw& draw : duplicateDraws) {
+        draw.cmd->indirectBuffer = outputParamsBuffer.GetBuffer();
+        draw.cmd->indirectOffset = draw.outputParamsOffset;
+    }
+    for (const auto& [key, offset] : validatedParamsOffsets) {
+        validationCache->Add(key, outputParamsBuffer.GetBuffer(), offset);
+    }
+    validationCache->SetValidatedParamsEnd(outputParamsSize);
+
     // Now we allocate and populate host-side batch data to be copied to the GPU.
     for (Pass& pass : passes) {
         // We use std::malloc here because it guarantees maximal scalar alignment.
@@ -444,12 +573,12 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
         uint8_t* batchData = static_cast<uint8_t*>(pass.batchData.get());
         for (Batch& batch : pass.batches) {
             batch.batchInfo = new (&batchData[batch.dataBufferOffset]) BatchInfo();
-            batch.batchInfo->numDraws = static_cast<uint32_t>(batch.metadata->draws.size());
+            batch.batchInfo->numDraws = static_cast<uint32_t>(batch.draws.size());
             batch.batchInfo->flags = pass.flags;
 
             IndirectDraw* indirectDraw = reinterpret_cast<IndirectDraw*>(batch.batchInfo.get() + 1);
             uint64_t outputParamsOffset = batch.outputParamsOffset;
-            for (auto& draw : batch.metadata->draws) {
+            for (const auto& draw : batch.draws) {
                 // The shader uses this to index an array of u32, hence the division by 4 bytes.
                 indirectDraw->indirectOffset =
                     static_cast<uint32_t>((draw.inputBufferOffset - batch.inputIndirectOffset) / 4);
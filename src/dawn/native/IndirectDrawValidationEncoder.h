@@ -28,25 +28,88 @@
 #ifndef SRC_DAWN_NATIVE_INDIRECTDRAWVALIDATIONENCODER_H_
 #define SRC_DAWN_NATIVE_INDIRECTDRAWVALIDATIONENCODER_H_
 
+#include <cstdint>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "dawn/common/NonCopyable.h"
+#include "dawn/common/Ref.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/IndirectDrawMetadata.h"
 
 namespace dawn::native {
 
+class BufferBase;
 class CommandEncoder;
 struct CombinedLimits;
 class DeviceBase;
 class RenderPassResourceUsageTracker;
+struct SyncScopeResourceUsage;
 
 // The maximum number of draws call we can fit into a single validation batch. This is
 // essentially limited by the number of indirect parameter blocks that can fit into the maximum
 // allowed storage binding size (with the base limits, it is about 6.7M).
 uint32_t ComputeMaxDrawCallsPerIndirectValidationBatch(const CombinedLimits& limits);
 
+// Remembers where the validated parameters of the indirect draws of a command encoder's render
+// passes were written, so that draws with the same parameters in the same or a later render pass
+// of the encoder reuse them instead of being validated again. Entries are only valid while their
+// indirect buffers are not written to, so the cache is cleared when commands are encoded between
+// render passes or when a render pass writes to one of the indirect buffers.
+// Validation is only deduplicated within a single encoder. Reusing results across encoders or
+// submits would need per-buffer write generations, bumped by queue writes, mapping and GPU writes,
+// and checked at submit time, which is not done.
+class IndirectDrawValidationCache : public NonCopyable {
+  public:
+    struct Key {
+        IndirectDrawMetadata::IndexedIndirectConfig config;
+        uint64_t inputBufferOffset;
+        uint64_t numIndexBufferElements;
+        uint64_t indexBufferOffsetInElements;
+
+        bool operator==(const Key& other) const;
+
+        template <typename H>
+        friend H AbslHashValue(H h, const Key& key) {
+            return H::combine(std::move(h), key.config.inputIndirectBufferPtr,
+                              key.config.duplicateBaseVertexInstance, key.config.drawType,
+                              key.inputBufferOffset, key.numIndexBufferElements,
+                              key.indexBufferOffsetInElements);
+        }
+    };
+
+    struct ValidatedParams {
+        Ref<BufferBase> buffer;
+        uint64_t offset;
+    };
+
+    IndirectDrawValidationCache();
+    ~IndirectDrawValidationCache();
+
+    // Returns the validated parameters for the draw, or nullptr if they aren't cached.
+    const ValidatedParams* Find(const Key& key) const;
+    void Add(const Key& key, BufferBase* buffer, uint64_t offset);
+
+    // The end of the validated parameters written to the indirect scratch buffer by previous
+    // render passes. Later render passes write theirs after it so they don't overwrite them.
+    uint64_t GetValidatedParamsEnd() const;
+    void SetValidatedParamsEnd(uint64_t end);
+
+    void Clear();
+    void ClearIfAnyIndirectBufferWritten(const SyncScopeResourceUsage& usage);
+
+  private:
+    absl::flat_hash_map<Key, ValidatedParams> mValidatedParams;
+    absl::flat_hash_set<uintptr_t> mIndirectBuffers;
+    uint64_t mValidatedParamsEnd = 0;
+};
+
 MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                                                 CommandEncoder* commandEncoder,
                                                 RenderPassResourceUsageTracker* usageTracker,
-                                                IndirectDrawMetadata* indirectDrawMetadata);
+                                                IndirectDrawMetadata* indirectDrawMetadata,
+                                                IndirectDrawValidationCache* validationCache);
 
 }  // namespace dawn::native
 
@@ -43,6 +43,7 @@
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceRecorder.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "tint/lang/wgsl/features/status.h"
 
@@ -206,9 +207,14 @@ void InstanceBase::WillDropLastExternalRef() {
 
 // TODO(crbug.com/dawn/832): make the platform an initialization parameter of the instance.
 MaybeError InstanceBase::Initialize(const UnpackedPtr<InstanceDescriptor>& descriptor) {
-    // Initialize the platform to the default for now.
-    mDefaultPlatform = std::make_unique<dawn::platform::Platform>();
-    SetPlatform(mDefaultPlatform.get());
+    // Initialize the platform to the default for now. The default platform is the process-wide
+    // trace recorder when the environment requests trace events to be recorded.
+    mDefaultPlatform = platform::tracing::TraceRecorder::GetForProcess();
+    if (mDefaultPlatform == nullptr) {
+        mOwnedDefaultPlatform = std::make_unique<dawn::platform::Platform>();
+        mDefaultPlatform = mOwnedDefaultPlatform.get();
+    }
+    SetPlatform(mDefaultPlatform);
 
     // Process DawnInstanceDescriptor
     if (const auto* dawnDesc = descriptor.Get<DawnInstanceDescriptor>()) {
@@ -510,7 +516,7 @@ bool InstanceBase::IsBeginCaptureOnStartupEnabled() const {
 
 void InstanceBase::SetPlatform(dawn::platform::Platform* platform) {
     if (platform == nullptr) {
-        mPlatform = mDefaultPlatform.get();
+        mPlatform = mDefaultPlatform;
     } else {
         mPlatform = platform;
     }
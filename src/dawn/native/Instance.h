@@ -202,7 +202,10 @@ class InstanceBase final : public ErrorSink, public RefCountedWithExternalCount
     wgpu::LoggingCallback mLoggingCallback = nullptr;
     raw_ptr<void> mLoggingCallbackUserdata = nullptr;
 
-    std::unique_ptr<dawn::platform::Platform> mDefaultPlatform;
+    // The platform used when the embedder doesn't provide one. It is either the process-wide trace
+    // recorder or mOwnedDefaultPlatform.
+    raw_ptr<dawn::platform::Platform> mDefaultPlatform = nullptr;
+    std::unique_ptr<dawn::platform::Platform> mOwnedDefaultPlatform;
     raw_ptr<dawn::platform::Platform> mPlatform = nullptr;
 
     BackendsArray mBackends;
@@ -38,6 +38,8 @@
 
 namespace dawn::native {
 
+RenderBundleBackendData::~RenderBundleBackendData() = default;
+
 RenderBundleBase::RenderBundleBase(RenderBundleEncoder* encoder,
                                    const RenderBundleDescriptor* descriptor,
                                    Ref<AttachmentState> attachmentState,
@@ -58,6 +60,7 @@ RenderBundleBase::RenderBundleBase(RenderBundleEncoder* encoder,
 }
 
 void RenderBundleBase::DestroyImpl() {
+    mBackendData = nullptr;
     mIndirectDrawMetadata.ClearIndexedIndirectBufferValidationInfo();
     FreeCommands(&mCommands);
 
@@ -133,4 +136,14 @@ const IndirectDrawMetadata& RenderBundleBase::GetIndirectDrawMetadata() {
     return mIndirectDrawMetadata;
 }
 
+RenderBundleBackendData* RenderBundleBase::GetBackendData() const {
+    DAWN_ASSERT(!IsError());
+    return mBackendData.get();
+}
+
+void RenderBundleBase::SetBackendData(std::unique_ptr<RenderBundleBackendData> backendData) {
+    DAWN_ASSERT(!IsError());
+    mBackendData = std::move(backendData);
+}
+
 }  // namespace dawn::native
@@ -29,6 +29,7 @@
 #define SRC_DAWN_NATIVE_RENDERBUNDLE_H_
 
 #include <bitset>
+#include <memory>
 #include <string>
 
 #include "dawn/common/Constants.h"
@@ -47,6 +48,13 @@ namespace dawn::native {
 struct RenderBundleDescriptor;
 class RenderBundleEncoder;
 
+// Data that a backend caches on a RenderBundle, for example the bundle's commands pre-recorded in
+// the backend's native command format. It is released when the bundle is destroyed.
+class RenderBundleBackendData {
+  public:
+    virtual ~RenderBundleBackendData();
+};
+
 class RenderBundleBase final : public ApiObjectBase {
   public:
     RenderBundleBase(RenderBundleEncoder* encoder,
@@ -74,6 +82,9 @@ class RenderBundleBase final : public ApiObjectBase {
     const RenderPassResourceUsage& GetResourceUsage() const;
     const IndirectDrawMetadata& GetIndirectDrawMetadata();
 
+    RenderBundleBackendData* GetBackendData() const;
+    void SetBackendData(std::unique_ptr<RenderBundleBackendData> backendData);
+
   private:
     RenderBundleBase(DeviceBase* device, ErrorTag errorTag, const char* label);
 
@@ -87,6 +98,7 @@ class RenderBundleBase final : public ApiObjectBase {
     uint64_t mDrawCount;
     RenderPassResourceUsage mResourceUsage;
     std::string mEncoderLabel;
+    std::unique_ptr<RenderBundleBackendData> mBackendData;
 };
 
 }  // namespace dawn::native
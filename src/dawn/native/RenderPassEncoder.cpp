@@ -158,13 +158,37 @@ void RenderPassEncoder::TrackQueryAvailability(QuerySetBase* querySet, uint32_t
 }
 
 void RenderPassEncoder::APIEnd() {
+    // Most render passes can be ended without locking the device, allowing encoders on different
+    // threads to make progress concurrently.
+    if (!EndRequiresDeviceLock()) {
+        End();
+        return;
+    }
+
     // The encoding context might create additional resources, so we need to lock the device.
     auto deviceLock(GetDevice()->GetScopedLock());
     End();
 }
 
+bool RenderPassEncoder::EndRequiresDeviceLock() {
+    // Ending the pass twice is reported to the device directly.
+    if (mEnded) {
+        return true;
+    }
+
+    // The resolve workarounds encode copies or additional passes when the pass ends.
+    DeviceBase* device = GetDevice();
+    if (device->IsToggleEnabled(Toggle::AlwaysResolveIntoZeroLevelAndLayer) ||
+        device->IsToggleEnabled(Toggle::ResolveMultipleAttachmentInSeparatePasses)) {
+        return true;
+    }
+
+    // Validating indirect draws creates buffers, bind groups and pipelines.
+    return !mIndirectDrawMetadata.GetIndexedIndirectBufferValidationInfo()->empty();
+}
+
 void RenderPassEncoder::End() {
-    DAWN_ASSERT(GetDevice()->IsLockedByCurrentThreadIfNeeded());
+    DAWN_ASSERT(!EndRequiresDeviceLock() || GetDevice()->IsLockedByCurrentThreadIfNeeded());
 
     mCommandBufferState.End();
 
@@ -107,6 +107,10 @@ class RenderPassEncoder final : public RenderEncoderBase {
   private:
     void DestroyImpl() override;
 
+    // Returns true if End() might create resources or report errors directly to the device, in
+    // which case the device must be locked.
+    bool EndRequiresDeviceLock();
+
     void TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex);
 
     // For render and compute passes, the encoding context is borrowed from the command encoder.
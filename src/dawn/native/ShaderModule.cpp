@@ -1317,6 +1317,9 @@ ShaderModuleBase::ShaderModuleBase(DeviceBase* device,
     if (auto* spirvDesc = descriptor.Get<ShaderModuleSPIRVDescriptor>()) {
         mType = Type::Spirv;
         mOriginalSpirv.assign(spirvDesc->code, spirvDesc->code + spirvDesc->codeSize);
+        if (auto* spirvOptions = descriptor.Get<DawnShaderModuleSPIRVOptionsDescriptor>()) {
+            mSpirvAllowNonUniformDerivatives = spirvOptions->allowNonUniformDerivatives;
+        }
     } else if (auto* wgslDesc = descriptor.Get<ShaderModuleWGSLDescriptor>()) {
         mType = Type::Wgsl;
         mWgsl = std::string(wgslDesc->code);
@@ -1384,6 +1387,7 @@ size_t ShaderModuleBase::ComputeContentHash() {
     ObjectContentHasher recorder;
     recorder.Record(mType);
     recorder.Record(mOriginalSpirv);
+    recorder.Record(mSpirvAllowNonUniformDerivatives);
     recorder.Record(mWgsl);
     recorder.Record(mStrictMath);
     return recorder.GetContentHash();
@@ -1391,8 +1395,9 @@ size_t ShaderModuleBase::ComputeContentHash() {
 
 bool ShaderModuleBase::EqualityFunc::operator()(const ShaderModuleBase* a,
                                                 const ShaderModuleBase* b) const {
-    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv && a->mWgsl == b->mWgsl &&
-           a->mStrictMath == b->mStrictMath;
+    return a->mType == b->mType && a->mOriginalSpirv == b->mOriginalSpirv &&
+           a->mSpirvAllowNonUniformDerivatives == b->mSpirvAllowNonUniformDerivatives &&
+           a->mWgsl == b->mWgsl && a->mStrictMath == b->mStrictMath;
 }
 
 ShaderModuleBase::ScopedUseTintProgram ShaderModuleBase::UseTintProgram() {
@@ -1408,32 +1413,45 @@ ShaderModuleBase::ScopedUseTintProgram ShaderModuleBase::UseTintProgram() {
         // up from the cache and return the same ShaderModuleBase. In this case, we have to
         // recreate mTintProgram, when the mTintProgram is required for initializing new
         // pipelines.
-        ShaderModuleDescriptor descriptor;
-        ShaderModuleWGSLDescriptor wgslDescriptor;
-        ShaderModuleSPIRVDescriptor sprivDescriptor;
-
+        //
+        // The source was fully validated when the module was created, so only the Tint front-end
+        // needs to run again. Work that doesn't contribute to the program, like descriptor
+        // validation, SPIR-V validation with SPIRV-Tools and shader dumping, is skipped.
+        DeviceBase* device = GetDevice();
+        ScopedTintICEHandler scopedICEHandler(device);
+
+        Ref<TintProgram> tintProgram;
         switch (mType) {
-            case Type::Spirv:
-                sprivDescriptor.codeSize = mOriginalSpirv.size();
-                sprivDescriptor.code = mOriginalSpirv.data();
-                descriptor.nextInChain = &sprivDescriptor;
+#if TINT_BUILD_SPV_READER
+            case Type::Spirv: {
+                DawnShaderModuleSPIRVOptionsDescriptor spirvOptions = {};
+                spirvOptions.allowNonUniformDerivatives = mSpirvAllowNonUniformDerivatives;
+                tint::Program program =
+                    ParseSPIRV(mOriginalSpirv, device->GetWGSLAllowedFeatures(),
+                               /*outMessages=*/nullptr, &spirvOptions)
+                        .AcquireSuccess();
+                tintProgram = AcquireRef(new TintProgram(std::move(program), nullptr));
                 break;
-            case Type::Wgsl:
-                wgslDescriptor.code = mWgsl.c_str();
-                descriptor.nextInChain = &wgslDescriptor;
+            }
+#endif  // TINT_BUILD_SPV_READER
+            case Type::Wgsl: {
+                auto tintFile = std::make_unique<tint::Source::File>("", mWgsl);
+                auto validationMode = device->IsCompatibilityMode()
+                                          ? tint::wgsl::ValidationMode::kCompat
+                                          : tint::wgsl::ValidationMode::kFull;
+                tint::Program program =
+                    ParseWGSL(tintFile.get(), device->GetWGSLAllowedFeatures(), validationMode,
+                              mInternalExtensions, /*outMessages=*/nullptr)
+                        .AcquireSuccess();
+                tintProgram = AcquireRef(new TintProgram(std::move(program), std::move(tintFile)));
                 break;
+            }
             default:
-                DAWN_ASSERT(false);
+                DAWN_UNREACHABLE();
         }
+        DAWN_ASSERT(tintProgram != nullptr);
 
-        ShaderModuleParseResult parseResult;
-        ValidateAndParseShaderModule(GetDevice(), Unpack(&descriptor), mInternalExtensions,
-                                     &parseResult,
-                                     /*compilationMessages=*/nullptr)
-            .AcquireSuccess();
-        DAWN_ASSERT(parseResult.tintProgram != nullptr);
-
-        tintData->tintProgram = std::move(parseResult.tintProgram);
+        tintData->tintProgram = std::move(tintProgram);
         tintData->tintProgramRecreateCount++;
 
         return ScopedUseTintProgram(this);
@@ -348,6 +348,7 @@ class ShaderModuleBase : public RefCountedWithExternalCountBase<ApiObjectBase>,
     enum class Type { Undefined, Spirv, Wgsl };
     Type mType;
     std::vector<uint32_t> mOriginalSpirv;
+    bool mSpirvAllowNonUniformDerivatives = false;
     std::string mWgsl;
 
     // TODO(dawn:2503): Remove the optional when Dawn can has a consistent default across backends.
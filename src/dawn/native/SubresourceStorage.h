@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_NATIVE_SUBRESOURCESTORAGE_H_
 #define SRC_DAWN_NATIVE_SUBRESOURCESTORAGE_H_
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
@@ -214,7 +215,14 @@ class SubresourceStorage {
     void DecompressLayer(uint32_t aspectIndex, uint32_t layer);
     void RecompressLayer(uint32_t aspectIndex, uint32_t layer);
 
-    SubresourceRange GetFullLayerRange(Aspect aspect, uint32_t layer) const;
+    SubresourceRange GetFullLayerRange(Aspect aspect,
+                                       uint32_t layer,
+                                       uint32_t layerCount = 1) const;
+
+    // Returns the end of the run of compressed layers starting at `layer` that all have the same
+    // data as `layer`, stopping at `layerLimit`. `layer` must be compressed. This allows handling a
+    // range of layers with the same state at once instead of layer by layer.
+    uint32_t CompressedLayerRunEnd(uint32_t aspectIndex, uint32_t layer, uint32_t layerLimit) const;
 
     // LayerCompressed should never be called when the aspect is compressed otherwise it would
     // need to check that mLayerCompressed is not null before indexing it.
@@ -303,8 +311,18 @@ void SubresourceStorage<T>::Update(const SubresourceRange& range, F&& updateFunc
             // fallback to per-level handling.
             if (LayerCompressed(aspectIndex, layer)) {
                 if (fullLayers) {
-                    SubresourceRange updateRange = GetFullLayerRange(aspect, layer);
-                    updateFunc(updateRange, &Data(aspectIndex, layer));
+                    // All the layers in a run of compressed layers with the same data get the
+                    // same update, so call updateFunc once for the run and copy the result to the
+                    // other layers of the run.
+                    uint32_t runEnd = CompressedLayerRunEnd(aspectIndex, layer, layerEnd);
+                    SubresourceRange updateRange =
+                        GetFullLayerRange(aspect, layer, runEnd - layer);
+                    T& layerData = Data(aspectIndex, layer);
+                    updateFunc(updateRange, &layerData);
+                    for (uint32_t runLayer = layer + 1; runLayer < runEnd; runLayer++) {
+                        Data(aspectIndex, runLayer) = layerData;
+                    }
+                    layer = runEnd - 1;
                     continue;
                 }
                 DecompressLayer(aspectIndex, layer);
@@ -361,13 +379,17 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
         }
 
         for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
-            // Similarly to above, use a fast path if other's layer is compressed.
+            // Similarly to above, use a fast path if other's layer is compressed. Consecutive
+            // compressed layers of other with the same data are merged with a single Update().
             if (other.LayerCompressed(aspectIndex, layer)) {
                 const U& otherData = other.Data(aspectIndex, layer);
-                Update(GetFullLayerRange(aspect, layer),
+                uint32_t layerEnd =
+                    other.CompressedLayerRunEnd(aspectIndex, layer, mArrayLayerCount);
+                Update(GetFullLayerRange(aspect, layer, layerEnd - layer),
                        [&](const SubresourceRange& subrange, T* data) {
                            mergeFunc(subrange, data, otherData);
                        });
+                layer = layerEnd - 1;
                 continue;
             }
 
@@ -412,14 +434,17 @@ R SubresourceStorage<T>::Iterate(F&& iterateFunc) const {
         }
 
         for (uint32_t layer = 0; layer < mArrayLayerCount; layer++) {
-            // Fast path, call iterateFunc on the whole array layer at once.
+            // Fast path, call iterateFunc on the whole array layer at once, or on a run of
+            // consecutive compressed array layers that have the same data.
             if (LayerCompressed(aspectIndex, layer)) {
-                SubresourceRange range = GetFullLayerRange(aspect, layer);
+                uint32_t layerEnd = CompressedLayerRunEnd(aspectIndex, layer, mArrayLayerCount);
+                SubresourceRange range = GetFullLayerRange(aspect, layer, layerEnd - layer);
                 if constexpr (mayError) {
                     DAWN_TRY(iterateFunc(range, Data(aspectIndex, layer)));
                 } else {
                     iterateFunc(range, Data(aspectIndex, layer));
                 }
+                layer = layerEnd - 1;
                 continue;
             }
 
@@ -562,8 +587,26 @@ void SubresourceStorage<T>::RecompressLayer(uint32_t aspectIndex, uint32_t layer
 }
 
 template <typename T>
-SubresourceRange SubresourceStorage<T>::GetFullLayerRange(Aspect aspect, uint32_t layer) const {
-    return {aspect, {layer, 1}, {0, mMipLevelCount}};
+SubresourceRange SubresourceStorage<T>::GetFullLayerRange(Aspect aspect,
+                                                          uint32_t layer,
+                                                          uint32_t layerCount) const {
+    return {aspect, {layer, layerCount}, {0, mMipLevelCount}};
+}
+
+template <typename T>
+uint32_t SubresourceStorage<T>::CompressedLayerRunEnd(uint32_t aspectIndex,
+                                                      uint32_t layer,
+                                                      uint32_t layerLimit) const {
+    DAWN_ASSERT(LayerCompressed(aspectIndex, layer));
+    DAWN_ASSERT(layer < layerLimit && layerLimit <= mArrayLayerCount);
+    const T& layerData = Data(aspectIndex, layer);
+
+    uint32_t layerEnd = layer + 1;
+    while (layerEnd < layerLimit && LayerCompressed(aspectIndex, layerEnd) &&
+           Data(aspectIndex, layerEnd) == layerData) {
+        layerEnd++;
+    }
+    return layerEnd;
 }
 
 template <typename T>
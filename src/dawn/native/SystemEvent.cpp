@@ -34,6 +34,10 @@
 #elif DAWN_PLATFORM_IS(FUCHSIA)
 #include <poll.h>
 #include <unistd.h>
+#elif DAWN_PLATFORM_IS(LINUX)
+#include <sys/eventfd.h>
+#include <sys/poll.h>
+#include <unistd.h>
 #elif DAWN_PLATFORM_IS(POSIX)
 #include <sys/poll.h>
 #include <unistd.h>
@@ -47,17 +51,41 @@
 
 namespace dawn::native {
 
+#if DAWN_PLATFORM_IS(LINUX)
+namespace {
+
+// On Linux, SystemEventReceivers are eventfds. Unlike a pipe, an eventfd can be signaled through
+// the fd that is waited on so it only needs a single fd, and it doesn't allocate a pipe buffer.
+SystemHandle CreateEventFd(bool signaled) {
+    int fd = eventfd(signaled ? 1 : 0, EFD_CLOEXEC);
+    DAWN_CHECK(fd >= 0);
+    return SystemHandle::Acquire(fd);
+}
+
+void SignalEventFd(const SystemHandle& eventFd) {
+    uint64_t one = 1;
+    ssize_t status = write(eventFd.Get(), &one, sizeof(one));
+    DAWN_CHECK(status == sizeof(one));
+}
+
+}  // anonymous namespace
+#endif
+
 // SystemEventReceiver
 
 SystemEventReceiver::SystemEventReceiver(SystemHandle primitive)
     : mPrimitive(std::move(primitive)) {}
 
 SystemEventReceiver SystemEventReceiver::CreateAlreadySignaled() {
+#if DAWN_PLATFORM_IS(LINUX)
+    return SystemEventReceiver(CreateEventFd(/*signaled=*/true));
+#else
     SystemEventPipeSender sender;
     SystemEventReceiver receiver;
     std::tie(sender, receiver) = CreateSystemEventPipe();
     std::move(sender).Signal();
     return receiver;
+#endif
 }
 
 const SystemHandle& SystemEventReceiver::GetPrimitive() const {
@@ -80,6 +108,8 @@ void SystemEventPipeSender::Signal() && {
     DAWN_ASSERT(mPrimitive.IsValid());
 #if DAWN_PLATFORM_IS(WINDOWS)
     DAWN_CHECK(SetEvent(mPrimitive.Get()));
+#elif DAWN_PLATFORM_IS(LINUX)
+    SignalEventFd(mPrimitive);
 #elif DAWN_PLATFORM_IS(POSIX)
     // Send one byte to signal the receiver
     char zero[1] = {0};
@@ -109,6 +139,17 @@ std::pair<SystemEventPipeSender, SystemEventReceiver> CreateSystemEventPipe() {
     SystemEventPipeSender sender;
     sender.mPrimitive = SystemHandle::Acquire(eventDup);
 
+    return std::make_pair(std::move(sender), std::move(receiver));
+#elif DAWN_PLATFORM_IS(LINUX)
+    // The sender may outlive the receiver so it needs its own fd to the eventfd.
+    SystemEventReceiver receiver;
+    receiver.mPrimitive = CreateEventFd(/*signaled=*/false);
+
+    int senderFd = dup(receiver.mPrimitive.Get());
+    DAWN_CHECK(senderFd >= 0);
+    SystemEventPipeSender sender;
+    sender.mPrimitive = SystemHandle::Acquire(senderFd);
+
     return std::make_pair(std::move(sender), std::move(receiver));
 #elif DAWN_PLATFORM_IS(POSIX)
     int pipeFds[2];
@@ -153,12 +194,20 @@ bool SystemEvent::IsSignaled() const {
 void SystemEvent::Signal() {
     if (!mSignaled.exchange(true, std::memory_order_acq_rel)) {
         mPipe.Use([](auto pipe) {
+#if DAWN_PLATFORM_IS(LINUX)
+            // The receiver is an eventfd that is signaled directly. It is created already signaled
+            // if GetOrCreateSystemEventReceiver runs after this.
+            if (*pipe) {
+                SignalEventFd(pipe->value().second.GetPrimitive());
+            }
+#else
             // Check if there is a pipe and the sender is valid.
             // This function may race with GetOrCreateSystemEventReceiver such that the pipe is
             // already signaled and the sender is invalid.
             if (*pipe && pipe->value().first.IsValid()) {
                 std::move(pipe->value().first).Signal();
             }
+#endif
         });
     }
 }
@@ -170,11 +219,16 @@ const SystemEventReceiver& SystemEvent::GetOrCreateSystemEventReceiver() {
             // this function races with another thread performing Signal. If we won
             // the race, then the pipe we just created will get signaled inside Signal.
             // If we lost the race, then it will not be signaled and we must do it now.
+#if DAWN_PLATFORM_IS(LINUX)
+            // Signal writes to the eventfd of the receiver, so no sender is needed.
+            *pipe = {SystemEventPipeSender{}, SystemEventReceiver(CreateEventFd(IsSignaled()))};
+#else
             if (IsSignaled()) {
                 *pipe = {SystemEventPipeSender{}, SystemEventReceiver::CreateAlreadySignaled()};
             } else {
                 *pipe = CreateSystemEventPipe();
             }
+#endif
         }
         return std::cref(pipe->value().second);
     });
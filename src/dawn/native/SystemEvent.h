@@ -101,6 +101,8 @@ class SystemEventPipeSender final : NonCopyable {
 //   CreateEvent() and signal it with SetEvent().
 // - On POSIX, SystemEventReceiver is a file descriptor (fd), so we can create one with pipe(), and
 //   signal it by write()ing into the pipe (to make it become readable, though we won't read() it).
+// - On Linux, SystemEventReceiver is an eventfd instead, which the sender write()s into through a
+//   dup() of the fd. SystemEvent doesn't need the sender and signals the eventfd directly.
 std::pair<SystemEventPipeSender, SystemEventReceiver> CreateSystemEventPipe();
 
 class SystemEvent : public RefCounted {
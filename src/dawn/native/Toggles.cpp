@@ -598,6 +598,20 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
       "Don't validate the required VkImage size against the size of the AHardwareBuffer on import. "
       "Some drivers report the wrong size.",
       "https://crbug.com/333424893", ToggleStage::Device}},
+    {Toggle::NullExecuteComputeShaders,
+     {"null_execute_compute_shaders",
+      "Make the Null backend execute the buffer copies and compute passes of submitted command "
+      "buffers on the CPU, running compute shaders with the Tint IR interpreter. Render passes and "
+      "texture operations are still ignored.",
+      "https://crbug.com/tint/1718", ToggleStage::Device}},
+    // TODO(dawn): Replace the tracker link with the bug tracking secondary command buffers for
+    // render bundles once it is filed.
+    {Toggle::VulkanRecordRenderBundlesInSecondaryCommandBuffers,
+     {"vulkan_record_render_bundles_in_secondary_command_buffers",
+      "Record render bundles once in Vulkan secondary command buffers and execute them with "
+      "vkCmdExecuteCommands in render passes that contain only ExecuteBundles commands, instead of "
+      "re-encoding the bundle commands each time they are executed.",
+      "https://crbug.com/dawn", ToggleStage::Device}},
     // Comment to separate the }} so it is clearer what to copy-paste to add a toggle.
 }};
 }  // anonymous namespace
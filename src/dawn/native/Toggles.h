@@ -147,6 +147,8 @@ enum class Toggle {
 
     D3D11UseUnmonitoredFence,
     IgnoreImportedAHardwareBufferVulkanImageSize,
+    NullExecuteComputeShaders,
+    VulkanRecordRenderBundlesInSecondaryCommandBuffers,
 
     EnumCount,
     InvalidEnum = EnumCount,
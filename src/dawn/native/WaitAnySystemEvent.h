@@ -44,6 +44,7 @@
 #endif
 
 #include "absl/container/inlined_vector.h"
+#include "dawn/common/FutureUtils.h"
 #include "dawn/common/Log.h"
 #include "dawn/native/SystemEvent.h"
 
@@ -96,7 +97,9 @@ template <typename It>
     *(*(begin + completedIndex)).second = true;
     return true;
 #elif DAWN_PLATFORM_IS(POSIX)
-    absl::InlinedVector<pollfd, 4 /* avoid heap allocation for small waits */> pollfds;
+    // Timed waits of the EventManager are limited to kTimedWaitAnyMaxCountDefault events, so they
+    // never need a heap allocation.
+    absl::InlinedVector<pollfd, kTimedWaitAnyMaxCountDefault> pollfds;
     pollfds.reserve(count);
     for (auto it = begin; it != end; ++it) {
         pollfds.push_back(pollfd{static_cast<int>((*it).first.mPrimitive.Get()), POLLIN, 0});
@@ -27,10 +27,12 @@
 
 #include "dawn/native/null/DeviceNull.h"
 
+#include <cstring>
 #include <limits>
 #include <utility>
 
 #include "dawn/native/BackendConnection.h"
+#include "dawn/native/BindGroupTracker.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/Commands.h"
 #include "dawn/native/ErrorData.h"
@@ -38,6 +40,7 @@
 #include "dawn/native/Surface.h"
 #include "dawn/native/TintUtils.h"
 #include "partition_alloc/pointers/raw_ptr.h"
+#include "src/tint/lang/core/ir/interpreter/interpreter.h"
 
 #include "tint/tint.h"
 
@@ -356,7 +359,8 @@ BindGroupLayout::BindGroupLayout(DeviceBase* device, const BindGroupLayoutDescri
 
 Buffer::Buffer(Device* device, const UnpackedPtr<BufferDescriptor>& descriptor)
     : BufferBase(device, descriptor) {
-    mBackingData = std::unique_ptr<uint8_t[]>(new uint8_t[GetSize()]);
+    // Value-initialize the data so that buffers read by executed commands start zeroed.
+    mBackingData = std::unique_ptr<uint8_t[]>(new uint8_t[GetSize()]());
     mAllocatedSize = GetSize();
 }
 
@@ -393,6 +397,10 @@ void* Buffer::GetMappedPointer() {
     return mBackingData.get();
 }
 
+uint8_t* Buffer::GetData() {
+    return mBackingData.get();
+}
+
 void Buffer::UnmapImpl() {}
 
 void Buffer::DestroyImpl() {
@@ -412,6 +420,177 @@ void Buffer::DestroyImpl() {
 CommandBuffer::CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor)
     : CommandBufferBase(encoder, descriptor) {}
 
+namespace {
+
+class BindGroupTracker : public BindGroupTrackerBase<false, uint64_t> {
+  public:
+    // Binds the buffers of the bind groups used by the current pipeline to the interpreter.
+    void Apply(tint::core::ir::interpreter::Interpreter* interpreter) {
+        BeforeApply();
+        for (BindGroupIndex index : IterateBitSet(mBindGroupLayoutsMask)) {
+            BindGroupBase* group = mBindGroups[index];
+            const BindGroupLayoutInternalBase* layout = group->GetLayout();
+            for (const auto& [bindingNumber, bindingIndex] : layout->GetBindingMap()) {
+                const BindingInfo& bindingInfo = layout->GetBindingInfo(bindingIndex);
+                if (!std::holds_alternative<BufferBindingInfo>(bindingInfo.bindingLayout)) {
+                    continue;
+                }
+
+                BufferBinding binding = group->GetBindingAsBufferBinding(bindingIndex);
+                uint64_t offset = binding.offset;
+                if (bindingIndex < mDynamicOffsets[index].size()) {
+                    offset += mDynamicOffsets[index][bindingIndex];
+                }
+                interpreter->BindBuffer(
+                    tint::BindingPoint{static_cast<uint32_t>(index),
+                                       static_cast<uint32_t>(bindingNumber)},
+                    tint::Slice<uint8_t>(ToBackend(binding.buffer)->GetData() + offset,
+                                         binding.size));
+            }
+        }
+        AfterApply();
+    }
+};
+
+MaybeError DispatchOnCPU(ComputePipeline* pipeline,
+                         BindGroupTracker* bindGroups,
+                         uint32_t x,
+                         uint32_t y,
+                         uint32_t z) {
+    tint::core::ir::interpreter::Interpreter* interpreter = pipeline->GetInterpreter();
+    DAWN_ASSERT(interpreter != nullptr);
+    bindGroups->Apply(interpreter);
+
+    const ProgrammableStage& computeStage = pipeline->GetStage(SingleShaderStage::Compute);
+    auto result = interpreter->Dispatch(computeStage.entryPoint, {x, y, z});
+    if (result != tint::Success) {
+        return DAWN_FORMAT_INTERNAL_ERROR("Failed to execute %s on the CPU:\n%s", pipeline,
+                                          result.Failure().reason.Str());
+    }
+    return {};
+}
+
+}  // anonymous namespace
+
+MaybeError CommandBuffer::Execute() {
+    MaybeError result = ExecuteCommands();
+    // A failure stops the iteration in the middle of the commands. Rewind the iterator like the
+    // end of the iteration does, so that the commands can be iterated again to free them.
+    mCommands.Reset();
+    return result;
+}
+
+MaybeError CommandBuffer::ExecuteCommands() {
+    Command type;
+    while (mCommands.NextCommandId(&type)) {
+        switch (type) {
+            case Command::BeginComputePass: {
+                mCommands.NextCommand<BeginComputePassCmd>();
+                DAWN_TRY(ExecuteComputePass());
+                break;
+            }
+
+            case Command::CopyBufferToBuffer: {
+                CopyBufferToBufferCmd* copy = mCommands.NextCommand<CopyBufferToBufferCmd>();
+                if (copy->size == 0) {
+                    // Skip no-op copies.
+                    break;
+                }
+                memmove(ToBackend(copy->destination.Get())->GetData() + copy->destinationOffset,
+                        ToBackend(copy->source.Get())->GetData() + copy->sourceOffset,
+                        copy->size);
+                break;
+            }
+
+            case Command::ClearBuffer: {
+                ClearBufferCmd* cmd = mCommands.NextCommand<ClearBufferCmd>();
+                if (cmd->size == 0) {
+                    // Skip no-op fills.
+                    break;
+                }
+                memset(ToBackend(cmd->buffer.Get())->GetData() + cmd->offset, 0, cmd->size);
+                break;
+            }
+
+            case Command::WriteBuffer: {
+                WriteBufferCmd* cmd = mCommands.NextCommand<WriteBufferCmd>();
+                if (cmd->size == 0) {
+                    // Skip no-op writes.
+                    break;
+                }
+                uint8_t* data = mCommands.NextData<uint8_t>(cmd->size);
+                ToBackend(cmd->buffer.Get())->DoWriteBuffer(cmd->offset, data, cmd->size);
+                break;
+            }
+
+            default:
+                // Render passes, texture operations and queries are not executed.
+                SkipCommand(&mCommands, type);
+                break;
+        }
+    }
+    return {};
+}
+
+MaybeError CommandBuffer::ExecuteComputePass() {
+    ComputePipeline* lastPipeline = nullptr;
+    BindGroupTracker bindGroups;
+
+    Command type;
+    while (mCommands.NextCommandId(&type)) {
+        switch (type) {
+            case Command::EndComputePass: {
+                mCommands.NextCommand<EndComputePassCmd>();
+                return {};
+            }
+
+            case Command::SetComputePipeline: {
+                SetComputePipelineCmd* cmd = mCommands.NextCommand<SetComputePipelineCmd>();
+                lastPipeline = ToBackend(cmd->pipeline.Get());
+                bindGroups.OnSetPipeline(lastPipeline);
+                break;
+            }
+
+            case Command::SetBindGroup: {
+                SetBindGroupCmd* cmd = mCommands.NextCommand<SetBindGroupCmd>();
+                uint32_t* dynamicOffsets = nullptr;
+                if (cmd->dynamicOffsetCount > 0) {
+                    dynamicOffsets = mCommands.NextData<uint32_t>(cmd->dynamicOffsetCount);
+                }
+                bindGroups.OnSetBindGroup(cmd->index, cmd->group.Get(), cmd->dynamicOffsetCount,
+                                          dynamicOffsets);
+                break;
+            }
+
+            case Command::Dispatch: {
+                DispatchCmd* dispatch = mCommands.NextCommand<DispatchCmd>();
+                DAWN_TRY(DispatchOnCPU(lastPipeline, &bindGroups, dispatch->x, dispatch->y,
+                                       dispatch->z));
+                break;
+            }
+
+            case Command::DispatchIndirect: {
+                DispatchIndirectCmd* dispatch = mCommands.NextCommand<DispatchIndirectCmd>();
+                uint32_t workgroups[3];
+                memcpy(workgroups,
+                       ToBackend(dispatch->indirectBuffer.Get())->GetData() +
+                           dispatch->indirectOffset,
+                       sizeof(workgroups));
+                DAWN_TRY(DispatchOnCPU(lastPipeline, &bindGroups, workgroups[0], workgroups[1],
+                                       workgroups[2]));
+                break;
+            }
+
+            default:
+                SkipCommand(&mCommands, type);
+                break;
+        }
+    }
+
+    // EndComputePass should have been called
+    DAWN_UNREACHABLE();
+}
+
 // QuerySet
 
 QuerySet::QuerySet(Device* device, const QuerySetDescriptor* descriptor)
@@ -423,10 +602,15 @@ Queue::Queue(Device* device, const QueueDescriptor* descriptor) : QueueBase(devi
 
 Queue::~Queue() {}
 
-MaybeError Queue::SubmitImpl(uint32_t, CommandBufferBase* const*) {
+MaybeError Queue::SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) {
     Device* device = ToBackend(GetDevice());
 
     DAWN_TRY(device->SubmitPendingOperations());
+    if (device->IsToggleEnabled(Toggle::NullExecuteComputeShaders)) {
+        for (uint32_t i = 0; i < commandCount; ++i) {
+            DAWN_TRY(ToBackend(commands[i])->Execute());
+        }
+    }
     IncrementLastSubmittedCommandSerial();
 
     return {};
@@ -499,9 +683,23 @@ MaybeError ComputePipeline::InitializeImpl() {
                    ? std::make_optional(limits.experimentalSubgroupLimits.maxSubgroupSize)
                    : std::nullopt));
 
+    if (GetDevice()->IsToggleEnabled(Toggle::NullExecuteComputeShaders)) {
+        auto ir = tint::wgsl::reader::ProgramToLoweredIR(transformedProgram);
+        DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
+                        ir.Failure().reason.Str());
+        mIRModule = std::make_unique<tint::core::ir::Module>(ir.Move());
+        mInterpreter = std::make_unique<tint::core::ir::interpreter::Interpreter>(*mIRModule);
+    }
+
     return {};
 }
 
+ComputePipeline::~ComputePipeline() = default;
+
+tint::core::ir::interpreter::Interpreter* ComputePipeline::GetInterpreter() const {
+    return mInterpreter.get();
+}
+
 // RenderPipeline
 MaybeError RenderPipeline::InitializeImpl() {
     return {};
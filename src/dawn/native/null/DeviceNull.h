@@ -52,6 +52,13 @@
 #include "dawn/native/dawn_platform.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
+namespace tint::core::ir {
+class Module;
+}  // namespace tint::core::ir
+namespace tint::core::ir::interpreter {
+class Interpreter;
+}  // namespace tint::core::ir::interpreter
+
 namespace dawn::native::null {
 
 class BindGroup;
@@ -259,6 +266,9 @@ class Buffer final : public BufferBase {
 
     void DoWriteBuffer(uint64_t bufferOffset, const void* data, size_t size);
 
+    // The contents of the buffer, used to execute command buffers on the CPU.
+    uint8_t* GetData();
+
   private:
     MaybeError MapAsyncImpl(wgpu::MapMode mode, size_t offset, size_t size) override;
     void UnmapImpl() override;
@@ -273,6 +283,14 @@ class Buffer final : public BufferBase {
 class CommandBuffer final : public CommandBufferBase {
   public:
     CommandBuffer(CommandEncoder* encoder, const CommandBufferDescriptor* descriptor);
+
+    // Runs the buffer copies and the compute passes of the command buffer on the CPU. Used when
+    // the NullExecuteComputeShaders toggle is enabled.
+    MaybeError Execute();
+
+  private:
+    MaybeError ExecuteCommands();
+    MaybeError ExecuteComputePass();
 };
 
 class QuerySet final : public QuerySetBase {
@@ -304,6 +322,17 @@ class ComputePipeline final : public ComputePipelineBase {
     using ComputePipelineBase::ComputePipelineBase;
 
     MaybeError InitializeImpl() override;
+
+    // The interpreter of the Tint IR of the compute stage, only created when the
+    // NullExecuteComputeShaders toggle is enabled. It is kept with the pipeline so that the IR is
+    // only analyzed by the first dispatch.
+    tint::core::ir::interpreter::Interpreter* GetInterpreter() const;
+
+  private:
+    ~ComputePipeline() override;
+
+    std::unique_ptr<tint::core::ir::Module> mIRModule;
+    std::unique_ptr<tint::core::ir::interpreter::Interpreter> mInterpreter;
 };
 
 class RenderPipeline final : public RenderPipelineBase {
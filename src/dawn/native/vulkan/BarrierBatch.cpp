@@ -0,0 +1,131 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/vulkan/BarrierBatch.h"
+
+#include "dawn/native/vulkan/BufferVk.h"
+#include "dawn/native/vulkan/CommandRecordingContext.h"
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/TextureVk.h"
+
+namespace dawn::native::vulkan {
+
+namespace {
+
+constexpr VkPipelineStageFlags kVertexStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                                               VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                                               VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+
+}  // anonymous namespace
+
+BarrierBatch::BarrierBatch() = default;
+
+BarrierBatch::~BarrierBatch() = default;
+
+BarrierBatch::BarrierBatch(BarrierBatch&&) = default;
+
+BarrierBatch& BarrierBatch::operator=(BarrierBatch&&) = default;
+
+BarrierBatch::Barriers* BarrierBatch::BarriersForStages(VkPipelineStageFlags dstStages) {
+    return (dstStages & kVertexStages) ? &mVertexBarriers : &mNonVertexBarriers;
+}
+
+void BarrierBatch::TransitionBuffer(CommandRecordingContext* recordingContext,
+                                    Buffer* buffer,
+                                    wgpu::BufferUsage usage,
+                                    wgpu::ShaderStage shaderStages) {
+    VkBufferMemoryBarrier barrier;
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+    if (buffer->TrackUsageAndGetResourceBarrier(recordingContext, usage, shaderStages, &barrier,
+                                                &srcStages, &dstStages)) {
+        Barriers* barriers = BarriersForStages(dstStages);
+        barriers->srcStages |= srcStages;
+        barriers->dstStages |= dstStages;
+        barriers->bufferBarriers.push_back(barrier);
+    }
+}
+
+void BarrierBatch::TransitionTexture(CommandRecordingContext* recordingContext,
+                                     Texture* texture,
+                                     wgpu::TextureUsage usage,
+                                     wgpu::ShaderStage shaderStages,
+                                     const SubresourceRange& range) {
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+    texture->TransitionUsageAndGetResourceBarriers(recordingContext, usage, shaderStages, range,
+                                                   &mTextureBarriers, &srcStages, &dstStages);
+    AddImageBarriers(srcStages, dstStages);
+}
+
+void BarrierBatch::TransitionTextureForPass(CommandRecordingContext* recordingContext,
+                                            Texture* texture,
+                                            const TextureSubresourceSyncInfo& textureSyncInfos) {
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+    texture->TransitionUsageForPass(recordingContext, textureSyncInfos, &mTextureBarriers,
+                                    &srcStages, &dstStages);
+    AddImageBarriers(srcStages, dstStages);
+}
+
+void BarrierBatch::AddImageBarriers(VkPipelineStageFlags srcStages,
+                                    VkPipelineStageFlags dstStages) {
+    if (mTextureBarriers.empty()) {
+        return;
+    }
+    Barriers* barriers = BarriersForStages(dstStages);
+    barriers->srcStages |= srcStages;
+    barriers->dstStages |= dstStages;
+    barriers->imageBarriers.insert(barriers->imageBarriers.end(), mTextureBarriers.begin(),
+                                   mTextureBarriers.end());
+    mTextureBarriers.clear();
+}
+
+void BarrierBatch::Record(Device* device, CommandRecordingContext* recordingContext) {
+    for (Barriers* barriers : {&mVertexBarriers, &mNonVertexBarriers}) {
+        if (!barriers->bufferBarriers.empty() || !barriers->imageBarriers.empty()) {
+            device->fn.CmdPipelineBarrier(
+                recordingContext->commandBuffer, barriers->srcStages, barriers->dstStages, 0, 0,
+                nullptr, barriers->bufferBarriers.size(), barriers->bufferBarriers.data(),
+                barriers->imageBarriers.size(), barriers->imageBarriers.data());
+        }
+    }
+    Reset();
+}
+
+void BarrierBatch::Reset() {
+    for (Barriers* barriers : {&mVertexBarriers, &mNonVertexBarriers}) {
+        // clear() keeps the capacity of the vectors for the next use of the batch.
+        barriers->bufferBarriers.clear();
+        barriers->imageBarriers.clear();
+        barriers->srcStages = 0;
+        barriers->dstStages = 0;
+    }
+    mTextureBarriers.clear();
+}
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,112 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_VULKAN_BARRIERBATCH_H_
+#define SRC_DAWN_NATIVE_VULKAN_BARRIERBATCH_H_
+
+#include <vector>
+
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/PassResourceUsage.h"
+#include "dawn/native/Subresource.h"
+#include "dawn/native/dawn_platform.h"
+
+namespace dawn::native::vulkan {
+
+class Buffer;
+struct CommandRecordingContext;
+class Device;
+class Texture;
+
+// Accumulates the barriers of several resource transitions so that they can be recorded with as
+// few vkCmdPipelineBarrier calls as possible, for example all the transitions of a synchronization
+// scope, or both the source and destination transitions of a copy. Barriers that aren't needed
+// are never added, as the resources only produce barriers when their tracked state changes.
+//
+// Barriers with vertex stages in their destination stages are kept separate from all other
+// barriers. This avoids creating unnecessary fragment->vertex dependencies when merging barriers.
+// Eg. merging a compute->vertex barrier and a fragment->fragment barrier would create a
+// compute|fragment->vertex|fragment barrier.
+//
+// The barrier arrays keep their storage when the batch is recorded, so that a batch that is
+// reused for each synchronization scope of a command buffer doesn't reallocate them. Moving the
+// batch moves that storage too.
+class BarrierBatch {
+  public:
+    BarrierBatch();
+    ~BarrierBatch();
+
+    BarrierBatch(const BarrierBatch&) = delete;
+    BarrierBatch& operator=(const BarrierBatch&) = delete;
+    BarrierBatch(BarrierBatch&&);
+    BarrierBatch& operator=(BarrierBatch&&);
+
+    // Transitions the resource to be used as `usage`, adding any necessary barrier to the batch.
+    void TransitionBuffer(CommandRecordingContext* recordingContext,
+                          Buffer* buffer,
+                          wgpu::BufferUsage usage,
+                          wgpu::ShaderStage shaderStages = wgpu::ShaderStage::None);
+    void TransitionTexture(CommandRecordingContext* recordingContext,
+                           Texture* texture,
+                           wgpu::TextureUsage usage,
+                           wgpu::ShaderStage shaderStages,
+                           const SubresourceRange& range);
+    // Transitions the texture for its usages in a pass, adding any necessary barrier to the batch.
+    void TransitionTextureForPass(CommandRecordingContext* recordingContext,
+                                  Texture* texture,
+                                  const TextureSubresourceSyncInfo& textureSyncInfos);
+
+    // Records all the barriers of the batch in the command buffer of `recordingContext`, and
+    // empties the batch.
+    void Record(Device* device, CommandRecordingContext* recordingContext);
+
+    // Empties the batch without recording its barriers, for instance when recording the commands
+    // that needed them failed.
+    void Reset();
+
+  private:
+    struct Barriers {
+        std::vector<VkBufferMemoryBarrier> bufferBarriers;
+        std::vector<VkImageMemoryBarrier> imageBarriers;
+        VkPipelineStageFlags srcStages = 0;
+        VkPipelineStageFlags dstStages = 0;
+    };
+
+    Barriers* BarriersForStages(VkPipelineStageFlags dstStages);
+    void AddImageBarriers(VkPipelineStageFlags srcStages, VkPipelineStageFlags dstStages);
+
+    Barriers mVertexBarriers;
+    Barriers mNonVertexBarriers;
+
+    // Storage for the barriers of a single texture transition, before they are added to the
+    // Barriers matching their destination stages.
+    std::vector<VkImageMemoryBarrier> mTextureBarriers;
+};
+
+}  // namespace dawn::native::vulkan
+
+#endif  // SRC_DAWN_NATIVE_VULKAN_BARRIERBATCH_H_
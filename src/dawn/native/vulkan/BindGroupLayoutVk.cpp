@@ -200,18 +200,31 @@ VkDescriptorSetLayout BindGroupLayout::GetHandle() const {
 ResultOrError<Ref<BindGroup>> BindGroupLayout::AllocateBindGroup(
     Device* device,
     const BindGroupDescriptor* descriptor) {
-    DescriptorSetAllocation descriptorSetAllocation;
-    DAWN_TRY_ASSIGN(descriptorSetAllocation, mDescriptorSetAllocator->Allocate(this));
-
-    return AcquireRef(mBindGroupAllocator->Allocate(device, descriptor, descriptorSetAllocation));
+    Ref<BindGroup> bindGroup = AcquireRef(mBindGroupAllocator->Allocate(device, descriptor));
+    DAWN_TRY(bindGroup->Initialize());
+    return bindGroup;
 }
 
 void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup,
-                                          DescriptorSetAllocation* descriptorSetAllocation) {
-    mDescriptorSetAllocator->Deallocate(descriptorSetAllocation);
+                                          DescriptorSetAllocation* descriptorSetAllocation,
+                                          DescriptorSetContents contents) {
+    mDescriptorSetAllocator->Deallocate(descriptorSetAllocation, std::move(contents));
+    mBindGroupAllocator->Deallocate(bindGroup);
+}
+
+void BindGroupLayout::DeallocateBindGroup(BindGroup* bindGroup) {
     mBindGroupAllocator->Deallocate(bindGroup);
 }
 
+ResultOrError<DescriptorSetAllocation> BindGroupLayout::AllocateDescriptorSet() {
+    return mDescriptorSetAllocator->Allocate(this);
+}
+
+std::optional<DescriptorSetAllocation> BindGroupLayout::ReuseDescriptorSet(
+    const DescriptorSetContents& contents) {
+    return mDescriptorSetAllocator->AllocateWithContents(contents);
+}
+
 void BindGroupLayout::SetLabelImpl() {
     SetDebugName(ToBackend(GetDevice()), mHandle, "Dawn_BindGroupLayout", GetLabel());
 }
@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_BINDGROUPLAYOUTVK_H_
 #define SRC_DAWN_NATIVE_VULKAN_BINDGROUPLAYOUTVK_H_
 
+#include <optional>
 #include <vector>
 
 #include "dawn/common/MutexProtected.h"
@@ -44,6 +45,7 @@ namespace dawn::native::vulkan {
 
 struct DescriptorSetAllocation;
 class DescriptorSetAllocator;
+struct DescriptorSetContents;
 class Device;
 
 VkDescriptorType VulkanDescriptorType(const BindingInfo& bindingInfo);
@@ -72,7 +74,14 @@ class BindGroupLayout final : public BindGroupLayoutInternalBase {
     ResultOrError<Ref<BindGroup>> AllocateBindGroup(Device* device,
                                                     const BindGroupDescriptor* descriptor);
     void DeallocateBindGroup(BindGroup* bindGroup,
-                             DescriptorSetAllocation* descriptorSetAllocation);
+                             DescriptorSetAllocation* descriptorSetAllocation,
+                             DescriptorSetContents contents);
+    // Deallocates a bind group that failed to get a descriptor set.
+    void DeallocateBindGroup(BindGroup* bindGroup);
+
+    ResultOrError<DescriptorSetAllocation> AllocateDescriptorSet();
+    std::optional<DescriptorSetAllocation> ReuseDescriptorSet(
+        const DescriptorSetContents& contents);
 
   private:
     ~BindGroupLayout() override;
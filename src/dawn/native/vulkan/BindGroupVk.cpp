@@ -27,12 +27,17 @@
 
 #include "dawn/native/vulkan/BindGroupVk.h"
 
+#include <optional>
+#include <utility>
+
 #include "dawn/common/BitSetIterator.h"
+#include "dawn/common/HashUtils.h"
 #include "dawn/common/MatchVariant.h"
 #include "dawn/common/ityp_stack_vec.h"
 #include "dawn/native/ExternalTexture.h"
 #include "dawn/native/vulkan/BindGroupLayoutVk.h"
 #include "dawn/native/vulkan/BufferVk.h"
+#include "dawn/native/vulkan/DescriptorSetAllocator.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/SamplerVk.h"
@@ -49,10 +54,68 @@ ResultOrError<Ref<BindGroup>> BindGroup::Create(Device* device,
         ->AllocateBindGroup(device, descriptor);
 }
 
-BindGroup::BindGroup(Device* device,
-                     const BindGroupDescriptor* descriptor,
-                     DescriptorSetAllocation descriptorSetAllocation)
-    : BindGroupBase(this, device, descriptor), mDescriptorSetAllocation(descriptorSetAllocation) {
+BindGroup::BindGroup(Device* device, const BindGroupDescriptor* descriptor)
+    : BindGroupBase(this, device, descriptor) {}
+
+MaybeError BindGroup::Initialize() {
+    BindGroupLayout* layout = ToBackend(GetLayout());
+
+    // Bind groups with the same contents as a recently destroyed one, like the ones an
+    // application creates each frame, reuse its descriptor set without writing it again.
+    std::optional<DescriptorSetAllocation> reusedAllocation =
+        layout->ReuseDescriptorSet(GetDescriptorSetContents());
+    if (reusedAllocation.has_value()) {
+        mDescriptorSetAllocation = *reusedAllocation;
+    } else {
+        DAWN_TRY_ASSIGN(mDescriptorSetAllocation, layout->AllocateDescriptorSet());
+        WriteDescriptorSet();
+    }
+
+    SetLabelImpl();
+
+    return {};
+}
+
+DescriptorSetContents BindGroup::GetDescriptorSetContents() {
+    const BindingIndex bindingCount = GetLayout()->GetBindingCount();
+
+    DescriptorSetContents contents;
+    contents.objects.reserve(static_cast<uint32_t>(bindingCount));
+    for (BindingIndex bindingIndex{0}; bindingIndex < bindingCount; ++bindingIndex) {
+        const BindingInfo& bindingInfo = GetLayout()->GetBindingInfo(bindingIndex);
+
+        ObjectBase* object = MatchVariant(
+            bindingInfo.bindingLayout,
+            [&](const BufferBindingInfo&) -> ObjectBase* {
+                BufferBinding binding = GetBindingAsBufferBinding(bindingIndex);
+                contents.bufferOffsetsAndSizes.push_back(binding.offset);
+                contents.bufferOffsetsAndSizes.push_back(binding.size);
+                HashCombine(&contents.hash, binding.offset, binding.size);
+                return binding.buffer;
+            },
+            [&](const SamplerBindingInfo&) -> ObjectBase* {
+                return GetBindingAsSampler(bindingIndex);
+            },
+            [&](const StaticSamplerBindingInfo&) -> ObjectBase* { return nullptr; },
+            [&](const TextureBindingInfo&) -> ObjectBase* {
+                return GetBindingAsTextureView(bindingIndex);
+            },
+            [&](const StorageTextureBindingInfo&) -> ObjectBase* {
+                return GetBindingAsTextureView(bindingIndex);
+            },
+            [&](const InputAttachmentBindingInfo&) -> ObjectBase* {
+                return GetBindingAsTextureView(bindingIndex);
+            });
+
+        HashCombine(&contents.hash, object);
+        contents.objects.emplace_back(object);
+    }
+    return contents;
+}
+
+void BindGroup::WriteDescriptorSet() {
+    Device* device = ToBackend(GetDevice());
+
     // Now do a write of a single descriptor set with all possible chained data allocated on the
     // stack.
     const uint32_t bindingCount = static_cast<uint32_t>((GetLayout()->GetBindingCount()));
@@ -178,15 +241,24 @@ BindGroup::BindGroup(Device* device,
 
     // TODO(crbug.com/dawn/855): Batch these updates
     device->fn.UpdateDescriptorSets(device->GetVkDevice(), numWrites, writes.data(), 0, nullptr);
-
-    SetLabelImpl();
 }
 
 BindGroup::~BindGroup() = default;
 
 void BindGroup::DestroyImpl() {
+    if (mDescriptorSetAllocation.set == VK_NULL_HANDLE) {
+        // Initialize failed to allocate a descriptor set.
+        BindGroupBase::DestroyImpl();
+        ToBackend(GetLayout())->DeallocateBindGroup(this);
+        return;
+    }
+
+    // Gather the contents of the descriptor set before BindGroupBase releases the bound objects,
+    // so that the descriptor set can be reused by an identical bind group.
+    DescriptorSetContents contents = GetDescriptorSetContents();
     BindGroupBase::DestroyImpl();
-    ToBackend(GetLayout())->DeallocateBindGroup(this, &mDescriptorSetAllocation);
+    ToBackend(GetLayout())
+        ->DeallocateBindGroup(this, &mDescriptorSetAllocation, std::move(contents));
 }
 
 VkDescriptorSet BindGroup::GetHandle() const {
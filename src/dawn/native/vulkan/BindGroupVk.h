@@ -37,21 +37,26 @@
 namespace dawn::native::vulkan {
 
 class Device;
+struct DescriptorSetContents;
 
 class BindGroup final : public BindGroupBase, public PlacementAllocated {
   public:
     static ResultOrError<Ref<BindGroup>> Create(Device* device,
                                                 const BindGroupDescriptor* descriptor);
 
-    BindGroup(Device* device,
-              const BindGroupDescriptor* descriptor,
-              DescriptorSetAllocation descriptorSetAllocation);
+    BindGroup(Device* device, const BindGroupDescriptor* descriptor);
+
+    MaybeError Initialize();
 
     VkDescriptorSet GetHandle() const;
 
   private:
     ~BindGroup() override;
 
+    // Returns the objects and buffer ranges that are written in the descriptor set.
+    DescriptorSetContents GetDescriptorSetContents();
+    void WriteDescriptorSet();
+
     void DestroyImpl() override;
 
     // Dawn API
@@ -28,6 +28,7 @@
 #include "dawn/native/vulkan/CommandBufferVk.h"
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "dawn/native/BindGroupTracker.h"
@@ -37,6 +38,7 @@
 #include "dawn/native/DynamicUploader.h"
 #include "dawn/native/EnumMaskIterator.h"
 #include "dawn/native/RenderBundle.h"
+#include "dawn/native/vulkan/BarrierBatch.h"
 #include "dawn/native/vulkan/BindGroupVk.h"
 #include "dawn/native/vulkan/BufferVk.h"
 #include "dawn/native/vulkan/CommandRecordingContext.h"
@@ -53,6 +55,7 @@
 #include "dawn/native/vulkan/TextureVk.h"
 #include "dawn/native/vulkan/UtilsVulkan.h"
 #include "dawn/native/vulkan/VulkanError.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::native::vulkan {
 
@@ -154,18 +157,17 @@ class DescriptorSetTracker : public BindGroupTrackerBase<true, uint32_t> {
   public:
     DescriptorSetTracker() = default;
 
-    void Apply(Device* device,
-               CommandRecordingContext* recordingContext,
-               VkPipelineBindPoint bindPoint) {
+    void Apply(Device* device, VkCommandBuffer commands, VkPipelineBindPoint bindPoint) {
         BeforeApply();
         for (BindGroupIndex dirtyIndex : IterateBitSet(mDirtyBindGroupsObjectChangedOrIsDynamic)) {
             VkDescriptorSet set = ToBackend(mBindGroups[dirtyIndex])->GetHandle();
             uint32_t count = static_cast<uint32_t>(mDynamicOffsets[dirtyIndex].size());
             const uint32_t* dynamicOffset =
                 count > 0 ? mDynamicOffsets[dirtyIndex].data() : nullptr;
-            device->fn.CmdBindDescriptorSets(
-                recordingContext->commandBuffer, bindPoint, ToBackend(mPipelineLayout)->GetHandle(),
-                static_cast<uint32_t>(dirtyIndex), 1, &*set, count, dynamicOffset);
+            device->fn.CmdBindDescriptorSets(commands, bindPoint,
+                                             ToBackend(mPipelineLayout)->GetHandle(),
+                                             static_cast<uint32_t>(dirtyIndex), 1, &*set, count,
+                                             dynamicOffset);
         }
         AfterApply();
     }
@@ -173,68 +175,23 @@ class DescriptorSetTracker : public BindGroupTrackerBase<true, uint32_t> {
 
 // Records the necessary barriers for a synchronization scope using the resource usage
 // data pre-computed in the frontend. Also performs lazy initialization if required.
-MaybeError TransitionAndClearForSyncScope(Device* device,
-                                          CommandRecordingContext* recordingContext,
-                                          const SyncScopeResourceUsage& scope) {
-    // Separate barriers with vertex stages in destination stages from all other barriers.
-    // This avoids creating unnecessary fragment->vertex dependencies when merging barriers.
-    // Eg. merging a compute->vertex barrier and a fragment->fragment barrier would create
-    // a compute|fragment->vertex|fragment barrier.
-    const VkPipelineStageFlags vertexStages = VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
-                                              VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
-                                              VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
-
-    struct Barriers {
-        std::vector<VkBufferMemoryBarrier> bufferBarriers;
-        std::vector<VkImageMemoryBarrier> imageBarriers;
-        VkPipelineStageFlags srcStages = 0;
-        VkPipelineStageFlags dstStages = 0;
-    };
-
-    Barriers vertexBarriers;
-    Barriers nonVertexBarriers;
-
-    auto MergeBufferBarrier = [](Barriers* barriers, VkPipelineStageFlags srcStages,
-                                 VkPipelineStageFlags dstStages,
-                                 const VkBufferMemoryBarrier& bufferBarrier) {
-        barriers->srcStages |= srcStages;
-        barriers->dstStages |= dstStages;
-        barriers->bufferBarriers.push_back(bufferBarrier);
-    };
+// Adds the barriers of the sync scope to the barrier batch of `recordingContext`, and clears the
+// textures it uses.
+MaybeError AddBarriersAndClearForSyncScope(CommandRecordingContext* recordingContext,
+                                           const SyncScopeResourceUsage& scope) {
+    BarrierBatch* barriers = &recordingContext->barriers;
 
     for (size_t i = 0; i < scope.buffers.size(); ++i) {
         Buffer* buffer = ToBackend(scope.buffers[i]);
         buffer->EnsureDataInitialized(recordingContext);
 
-        VkPipelineStageFlags srcStages = 0;
-        VkPipelineStageFlags dstStages = 0;
-
-        VkBufferMemoryBarrier bufferBarrier;
-        if (buffer->TrackUsageAndGetResourceBarrier(
-                recordingContext, scope.bufferSyncInfos[i].usage,
-                scope.bufferSyncInfos[i].shaderStages, &bufferBarrier, &srcStages, &dstStages)) {
-            MergeBufferBarrier((dstStages & vertexStages) ? &vertexBarriers : &nonVertexBarriers,
-                               srcStages, dstStages, bufferBarrier);
-        }
+        barriers->TransitionBuffer(recordingContext, buffer, scope.bufferSyncInfos[i].usage,
+                                   scope.bufferSyncInfos[i].shaderStages);
     }
 
-    auto MergeImageBarriers = [](Barriers* barriers, VkPipelineStageFlags srcStages,
-                                 VkPipelineStageFlags dstStages,
-                                 const std::vector<VkImageMemoryBarrier>& imageBarriers) {
-        barriers->srcStages |= srcStages;
-        barriers->dstStages |= dstStages;
-        barriers->imageBarriers.insert(barriers->imageBarriers.end(), imageBarriers.begin(),
-                                       imageBarriers.end());
-    };
-
-    // TODO(crbug.com/dawn/851): Add image barriers directly to the correct vector.
-    std::vector<VkImageMemoryBarrier> imageBarriers;
     for (size_t i = 0; i < scope.textures.size(); ++i) {
         Texture* texture = ToBackend(scope.textures[i]);
 
-        VkPipelineStageFlags srcStages = 0;
-        VkPipelineStageFlags dstStages = 0;
-
         // Clear subresources that are not render attachments. Render attachments will be
         // cleared in RecordBeginRenderPass by setting the loadop to clear when the texture
         // subresource has not been initialized before the render pass.
@@ -245,25 +202,27 @@ MaybeError TransitionAndClearForSyncScope(Device* device,
                 }
                 return {};
             }));
-        texture->TransitionUsageForPass(recordingContext, scope.textureSyncInfos[i], &imageBarriers,
-                                        &srcStages, &dstStages);
-
-        if (!imageBarriers.empty()) {
-            MergeImageBarriers((dstStages & vertexStages) ? &vertexBarriers : &nonVertexBarriers,
-                               srcStages, dstStages, imageBarriers);
-            imageBarriers.clear();
-        }
+        barriers->TransitionTextureForPass(recordingContext, texture, scope.textureSyncInfos[i]);
     }
 
-    for (const Barriers& barriers : {vertexBarriers, nonVertexBarriers}) {
-        if (!barriers.bufferBarriers.empty() || !barriers.imageBarriers.empty()) {
-            device->fn.CmdPipelineBarrier(
-                recordingContext->commandBuffer, barriers.srcStages, barriers.dstStages, 0, 0,
-                nullptr, barriers.bufferBarriers.size(), barriers.bufferBarriers.data(),
-                barriers.imageBarriers.size(), barriers.imageBarriers.data());
-        }
+    return {};
+}
+
+MaybeError TransitionAndClearForSyncScope(Device* device,
+                                          CommandRecordingContext* recordingContext,
+                                          const SyncScopeResourceUsage& scope) {
+    BarrierBatch* barriers = &recordingContext->barriers;
+
+    // The batch is kept across commands and submits, so don't leave the barriers of a scope that
+    // failed in it.
+    MaybeError maybeError = AddBarriersAndClearForSyncScope(recordingContext, scope);
+    if (maybeError.IsError()) {
+        barriers->Reset();
+        return maybeError;
     }
 
+    barriers->Record(device, recordingContext);
+
     return {};
 }
 
@@ -359,41 +318,40 @@ void RecordResolveQuerySetCmd(VkCommandBuffer commands,
     }
 }
 
-}  // anonymous namespace
-
-MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
-                                 Device* device,
-                                 BeginRenderPassCmd* renderPass) {
-    VkCommandBuffer commands = recordingContext->commandBuffer;
+// Query a VkRenderPass from the cache
+ResultOrError<VkRenderPass> QueryRenderPass(Device* device, BeginRenderPassCmd* renderPass) {
+    RenderPassCacheQuery query;
 
-    // Query a VkRenderPass from the cache
-    VkRenderPass renderPassVK = VK_NULL_HANDLE;
-    {
-        RenderPassCacheQuery query;
+    for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
+        const auto& attachmentInfo = renderPass->colorAttachments[i];
+        bool hasResolveTarget = attachmentInfo.resolveTarget != nullptr;
 
-        for (auto i : IterateBitSet(renderPass->attachmentState->GetColorAttachmentsMask())) {
-            const auto& attachmentInfo = renderPass->colorAttachments[i];
-            bool hasResolveTarget = attachmentInfo.resolveTarget != nullptr;
+        query.SetColor(i, attachmentInfo.view->GetFormat().format, attachmentInfo.loadOp,
+                       attachmentInfo.storeOp, hasResolveTarget);
+    }
 
-            query.SetColor(i, attachmentInfo.view->GetFormat().format, attachmentInfo.loadOp,
-                           attachmentInfo.storeOp, hasResolveTarget);
-        }
+    if (renderPass->attachmentState->HasDepthStencilAttachment()) {
+        const auto& attachmentInfo = renderPass->depthStencilAttachment;
 
-        if (renderPass->attachmentState->HasDepthStencilAttachment()) {
-            const auto& attachmentInfo = renderPass->depthStencilAttachment;
+        query.SetDepthStencil(attachmentInfo.view->GetTexture()->GetFormat().format,
+                              attachmentInfo.depthLoadOp, attachmentInfo.depthStoreOp,
+                              attachmentInfo.depthReadOnly, attachmentInfo.stencilLoadOp,
+                              attachmentInfo.stencilStoreOp, attachmentInfo.stencilReadOnly);
+    }
 
-            query.SetDepthStencil(attachmentInfo.view->GetTexture()->GetFormat().format,
-                                  attachmentInfo.depthLoadOp, attachmentInfo.depthStoreOp,
-                                  attachmentInfo.depthReadOnly, attachmentInfo.stencilLoadOp,
-                                  attachmentInfo.stencilStoreOp, attachmentInfo.stencilReadOnly);
-        }
+    query.SetSampleCount(renderPass->attachmentState->GetSampleCount());
 
-        query.SetSampleCount(renderPass->attachmentState->GetSampleCount());
+    RenderPassCache::RenderPassInfo renderPassInfo;
+    DAWN_TRY_ASSIGN(renderPassInfo, device->GetRenderPassCache()->GetRenderPass(query));
+    return renderPassInfo.renderPass;
+}
 
-        RenderPassCache::RenderPassInfo renderPassInfo;
-        DAWN_TRY_ASSIGN(renderPassInfo, device->GetRenderPassCache()->GetRenderPass(query));
-        renderPassVK = renderPassInfo.renderPass;
-    }
+MaybeError BeginRenderPass(CommandRecordingContext* recordingContext,
+                           Device* device,
+                           BeginRenderPassCmd* renderPass,
+                           VkRenderPass renderPassVK,
+                           VkSubpassContents subpassContents) {
+    VkCommandBuffer commands = recordingContext->commandBuffer;
 
     // Create a framebuffer that will be used once for the render pass and gather the clear
     // values for the attachments at the same time.
@@ -505,15 +463,440 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
     beginInfo.pClearValues = clearValues.data();
 
     if (renderPass->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any()) {
+        DAWN_ASSERT(subpassContents == VK_SUBPASS_CONTENTS_INLINE);
         DAWN_TRY(BeginRenderPassAndExpandResolveTextureWithDraw(device, recordingContext,
                                                                 renderPass, beginInfo));
     } else {
-        device->fn.CmdBeginRenderPass(commands, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        device->fn.CmdBeginRenderPass(commands, &beginInfo, subpassContents);
     }
 
     return {};
 }
 
+// Set the default value for the dynamic state
+void RecordDefaultDynamicState(Device* device,
+                               VkCommandBuffer commands,
+                               uint32_t width,
+                               uint32_t height) {
+    device->fn.CmdSetLineWidth(commands, 1.0f);
+    device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
+
+    device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, 0);
+
+    float blendConstants[4] = {
+        0.0f,
+        0.0f,
+        0.0f,
+        0.0f,
+    };
+    device->fn.CmdSetBlendConstants(commands, blendConstants);
+
+    // The viewport and scissor default to cover all of the attachments
+    VkViewport viewport;
+    viewport.x = 0.0f;
+    viewport.y = static_cast<float>(height);
+    viewport.width = static_cast<float>(width);
+    viewport.height = -static_cast<float>(height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    device->fn.CmdSetViewport(commands, 0, 1, &viewport);
+
+    VkRect2D scissorRect;
+    scissorRect.offset.x = 0;
+    scissorRect.offset.y = 0;
+    scissorRect.extent.width = width;
+    scissorRect.extent.height = height;
+    device->fn.CmdSetScissor(commands, 0, 1, &scissorRect);
+}
+
+// Records the commands that can be in a render bundle, tracking the bound descriptor sets and the
+// push constants needed by the ClampFragDepth transform. It is used for render passes as well as
+// for render bundles pre-recorded in secondary command buffers.
+class RenderCommandRecorder {
+  public:
+    RenderCommandRecorder(Device* device, VkCommandBuffer commands)
+        : mDevice(device), mCommands(commands) {}
+
+    void SetClampFragDepthArgs(float minDepth, float maxDepth) {
+        // Try applying the push constants that contain min/maxDepth immediately. This can be
+        // deferred if no pipeline is currently bound.
+        mClampFragDepthArgs = {minDepth, maxDepth};
+        mClampFragDepthArgsDirty = true;
+        ApplyClampFragDepthArgs();
+    }
+
+    void RecordCommand(CommandIterator* iter, Command type) {
+        switch (type) {
+            case Command::Draw: {
+                DrawCmd* draw = iter->NextCommand<DrawCmd>();
+
+                mDescriptorSets.Apply(mDevice, mCommands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+                mDevice->fn.CmdDraw(mCommands, draw->vertexCount, draw->instanceCount,
+                                    draw->firstVertex, draw->firstInstance);
+                break;
+            }
+
+            case Command::DrawIndexed: {
+                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+
+                mDescriptorSets.Apply(mDevice, mCommands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+                mDevice->fn.CmdDrawIndexed(mCommands, draw->indexCount, draw->instanceCount,
+                                           draw->firstIndex, draw->baseVertex,
+                                           draw->firstInstance);
+                break;
+            }
+
+            case Command::DrawIndirect: {
+                DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
+                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+
+                mDescriptorSets.Apply(mDevice, mCommands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+                mDevice->fn.CmdDrawIndirect(mCommands, buffer->GetHandle(),
+                                            static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
+                break;
+            }
+
+            case Command::DrawIndexedIndirect: {
+                DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
+                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+                DAWN_ASSERT(buffer != nullptr);
+
+                mDescriptorSets.Apply(mDevice, mCommands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+                mDevice->fn.CmdDrawIndexedIndirect(mCommands, buffer->GetHandle(),
+                                                   static_cast<VkDeviceSize>(draw->indirectOffset),
+                                                   1, 0);
+                break;
+            }
+
+            case Command::InsertDebugMarker: {
+                if (mDevice->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                    InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
+                    const char* label = iter->NextData<char>(cmd->length + 1);
+                    VkDebugUtilsLabelEXT utilsLabel;
+                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+                    utilsLabel.pNext = nullptr;
+                    utilsLabel.pLabelName = label;
+                    // Default color to black
+                    utilsLabel.color[0] = 0.0;
+                    utilsLabel.color[1] = 0.0;
+                    utilsLabel.color[2] = 0.0;
+                    utilsLabel.color[3] = 1.0;
+                    mDevice->fn.CmdInsertDebugUtilsLabelEXT(mCommands, &utilsLabel);
+                } else {
+                    SkipCommand(iter, Command::InsertDebugMarker);
+                }
+                break;
+            }
+
+            case Command::PopDebugGroup: {
+                if (mDevice->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                    iter->NextCommand<PopDebugGroupCmd>();
+                    mDevice->fn.CmdEndDebugUtilsLabelEXT(mCommands);
+                } else {
+                    SkipCommand(iter, Command::PopDebugGroup);
+                }
+                break;
+            }
+
+            case Command::PushDebugGroup: {
+                if (mDevice->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                    PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
+                    const char* label = iter->NextData<char>(cmd->length + 1);
+                    VkDebugUtilsLabelEXT utilsLabel;
+                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+                    utilsLabel.pNext = nullptr;
+                    utilsLabel.pLabelName = label;
+                    // Default color to black
+                    utilsLabel.color[0] = 0.0;
+                    utilsLabel.color[1] = 0.0;
+                    utilsLabel.color[2] = 0.0;
+                    utilsLabel.color[3] = 1.0;
+                    mDevice->fn.CmdBeginDebugUtilsLabelEXT(mCommands, &utilsLabel);
+                } else {
+                    SkipCommand(iter, Command::PushDebugGroup);
+                }
+                break;
+            }
+
+            case Command::SetBindGroup: {
+                SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
+                BindGroup* bindGroup = ToBackend(cmd->group.Get());
+                uint32_t* dynamicOffsets = nullptr;
+                if (cmd->dynamicOffsetCount > 0) {
+                    dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
+                }
+
+                mDescriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
+                                               dynamicOffsets);
+                break;
+            }
+
+            case Command::SetIndexBuffer: {
+                SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
+                VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
+
+                mDevice->fn.CmdBindIndexBuffer(mCommands, indexBuffer, cmd->offset,
+                                               VulkanIndexType(cmd->format));
+                break;
+            }
+
+            case Command::SetRenderPipeline: {
+                SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
+                RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+
+                mDevice->fn.CmdBindPipeline(mCommands, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                            pipeline->GetHandle());
+                mLastPipeline = pipeline;
+
+                mDescriptorSets.OnSetPipeline(pipeline);
+
+                // Apply the deferred min/maxDepth push constants update if needed.
+                ApplyClampFragDepthArgs();
+                break;
+            }
+
+            case Command::SetVertexBuffer: {
+                SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
+                VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
+                VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
+
+                mDevice->fn.CmdBindVertexBuffers(mCommands, static_cast<uint8_t>(cmd->slot), 1,
+                                                 &*buffer, &offset);
+                break;
+            }
+
+            default:
+                DAWN_UNREACHABLE();
+                break;
+        }
+    }
+
+  private:
+    void ApplyClampFragDepthArgs() {
+        if (!mClampFragDepthArgsDirty || mLastPipeline == nullptr) {
+            return;
+        }
+        mDevice->fn.CmdPushConstants(mCommands, ToBackend(mLastPipeline->GetLayout())->GetHandle(),
+                                     VK_SHADER_STAGE_FRAGMENT_BIT, kClampFragDepthArgsOffset,
+                                     kClampFragDepthArgsSize, &mClampFragDepthArgs);
+        mClampFragDepthArgsDirty = false;
+    }
+
+    raw_ptr<Device> mDevice;
+    VkCommandBuffer mCommands;
+    DescriptorSetTracker mDescriptorSets = {};
+    raw_ptr<RenderPipeline> mLastPipeline = nullptr;
+
+    // Tracking for the push constants needed by the ClampFragDepth transform.
+    // TODO(dawn:1125): Avoid the need for this when the depthClamp feature is available, but doing
+    // so would require fixing issue dawn:1576 first to have more dynamic push constant usage. (and
+    // also additional tests that the dirtying logic here is correct so with a Toggle we can test it
+    // on our infra).
+    ClampFragDepthArgs mClampFragDepthArgs = {0.0f, 1.0f};
+    bool mClampFragDepthArgsDirty = true;
+};
+
+// The secondary command buffers in which a render bundle is pre-recorded so that executing it in a
+// render pass is a single vkCmdExecuteCommands. Secondary command buffers inherit neither the
+// dynamic state nor the descriptor sets of the render pass, so each of them starts by setting the
+// default dynamic state for the size of the render pass it is recorded for. This is the state the
+// bundle starts with because only render passes that contain nothing but ExecuteBundles commands
+// execute secondary command buffers.
+class RenderBundleCommandBuffers final : public RenderBundleBackendData {
+  public:
+    static RenderBundleCommandBuffers* Get(Device* device, RenderBundleBase* bundle) {
+        if (bundle->GetBackendData() == nullptr) {
+            // The indirect draw validation changes the indirect buffer and offset of the indirect
+            // draws at each submit, so bundles containing them are recorded at each execution.
+            bool canBeRecorded = true;
+            CommandIterator* iter = bundle->GetCommands();
+            iter->Reset();
+            Command type;
+            while (iter->NextCommandId(&type)) {
+                if (type == Command::DrawIndirect || type == Command::DrawIndexedIndirect) {
+                    canBeRecorded = false;
+                }
+                SkipCommand(iter, type);
+            }
+
+            bundle->SetBackendData(std::unique_ptr<RenderBundleBackendData>(
+                new RenderBundleCommandBuffers(device, canBeRecorded)));
+        }
+        return static_cast<RenderBundleCommandBuffers*>(bundle->GetBackendData());
+    }
+
+    ~RenderBundleCommandBuffers() override {
+        if (mPool != VK_NULL_HANDLE) {
+            mDevice->GetFencedDeleter()->DeleteWhenUnused(mPool);
+        }
+    }
+
+    bool CanBeRecorded() const { return mCanBeRecorded; }
+
+    ResultOrError<VkCommandBuffer> GetOrRecord(RenderBundleBase* bundle,
+                                               VkRenderPass renderPass,
+                                               uint32_t width,
+                                               uint32_t height) {
+        DAWN_ASSERT(mCanBeRecorded);
+        for (const RecordedCommandBuffer& recorded : mCommandBuffers) {
+            if (recorded.renderPass == renderPass && recorded.width == width &&
+                recorded.height == height) {
+                return recorded.commandBuffer;
+            }
+        }
+
+        VkDevice vkDevice = mDevice->GetVkDevice();
+
+        // Start over with a new pool when the bundle was executed in too many different render
+        // passes. The command buffers of the previous pool may still be pending execution.
+        if (mCommandBuffers.size() >= kMaxCommandBuffers) {
+            mDevice->GetFencedDeleter()->DeleteWhenUnused(mPool);
+            mPool = VK_NULL_HANDLE;
+            mCommandBuffers.clear();
+        }
+
+        if (mPool == VK_NULL_HANDLE) {
+            VkCommandPoolCreateInfo createInfo;
+            createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+            createInfo.queueFamilyIndex = mDevice->GetGraphicsQueueFamily();
+
+            DAWN_TRY(CheckVkSuccess(
+                mDevice->fn.CreateCommandPool(vkDevice, &createInfo, nullptr, &*mPool),
+                "vkCreateCommandPool"));
+        }
+
+        RecordedCommandBuffer recorded = {renderPass, width, height, VK_NULL_HANDLE};
+
+        VkCommandBufferAllocateInfo allocateInfo;
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.pNext = nullptr;
+        allocateInfo.commandPool = mPool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocateInfo.commandBufferCount = 1;
+
+        DAWN_TRY(CheckVkSuccess(
+            mDevice->fn.AllocateCommandBuffers(vkDevice, &allocateInfo, &recorded.commandBuffer),
+            "vkAllocateCommandBuffers"));
+
+        VkCommandBufferInheritanceInfo inheritanceInfo;
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext = nullptr;
+        inheritanceInfo.renderPass = renderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+        inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+        inheritanceInfo.queryFlags = 0;
+        inheritanceInfo.pipelineStatistics = 0;
+
+        // The bundle can be executed in several command buffers that are pending at the same time.
+        VkCommandBufferBeginInfo beginInfo;
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext = nullptr;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                          VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        DAWN_TRY(
+            CheckVkSuccess(mDevice->fn.BeginCommandBuffer(recorded.commandBuffer, &beginInfo),
+                           "vkBeginCommandBuffer"));
+
+        RecordDefaultDynamicState(mDevice, recorded.commandBuffer, width, height);
+
+        RenderCommandRecorder recorder(mDevice, recorded.commandBuffer);
+        CommandIterator* iter = bundle->GetCommands();
+        iter->Reset();
+        Command type;
+        while (iter->NextCommandId(&type)) {
+            recorder.RecordCommand(iter, type);
+        }
+
+        DAWN_TRY(CheckVkSuccess(mDevice->fn.EndCommandBuffer(recorded.commandBuffer),
+                                "vkEndCommandBuffer"));
+
+        mCommandBuffers.push_back(recorded);
+        return recorded.commandBuffer;
+    }
+
+  private:
+    RenderBundleCommandBuffers(Device* device, bool canBeRecorded)
+        : mDevice(device), mCanBeRecorded(canBeRecorded) {}
+
+    // Bounds the number of command buffers kept for a bundle executed in render passes of many
+    // sizes or attachment load and store operations.
+    static constexpr size_t kMaxCommandBuffers = 4;
+
+    struct RecordedCommandBuffer {
+        VkRenderPass renderPass;
+        uint32_t width;
+        uint32_t height;
+        VkCommandBuffer commandBuffer;
+    };
+
+    raw_ptr<Device> mDevice;
+    bool mCanBeRecorded;
+    VkCommandPool mPool = VK_NULL_HANDLE;
+    std::vector<RecordedCommandBuffer> mCommandBuffers;
+};
+
+// Returns, for each render pass in the commands, whether it can execute its render bundles with
+// pre-recorded secondary command buffers: the render pass must contain only ExecuteBundles
+// commands and the bundles must not contain indirect draws.
+std::vector<bool> FindRenderPassesExecutingOnlyRecordableBundles(Device* device,
+                                                                 CommandIterator* commands) {
+    std::vector<bool> renderPasses;
+    bool executesBundles = false;
+    bool executesOnlyRecordableBundles = true;
+
+    Command type;
+    while (commands->NextCommandId(&type)) {
+        switch (type) {
+            case Command::BeginRenderPass:
+                executesBundles = false;
+                executesOnlyRecordableBundles = true;
+                SkipCommand(commands, type);
+                break;
+
+            case Command::EndRenderPass:
+                renderPasses.push_back(executesBundles && executesOnlyRecordableBundles);
+                SkipCommand(commands, type);
+                break;
+
+            case Command::ExecuteBundles: {
+                ExecuteBundlesCmd* cmd = commands->NextCommand<ExecuteBundlesCmd>();
+                auto bundles = commands->NextData<Ref<RenderBundleBase>>(cmd->count);
+                for (uint32_t i = 0; i < cmd->count; ++i) {
+                    if (!RenderBundleCommandBuffers::Get(device, bundles[i].Get())
+                             ->CanBeRecorded()) {
+                        executesOnlyRecordableBundles = false;
+                    }
+                }
+                executesBundles = true;
+                break;
+            }
+
+            default:
+                executesOnlyRecordableBundles = false;
+                SkipCommand(commands, type);
+                break;
+        }
+    }
+
+    return renderPasses;
+}
+
+}  // anonymous namespace
+
+MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
+                                 Device* device,
+                                 BeginRenderPassCmd* renderPass) {
+    VkRenderPass renderPassVK = VK_NULL_HANDLE;
+    DAWN_TRY_ASSIGN(renderPassVK, QueryRenderPass(device, renderPass));
+    return BeginRenderPass(recordingContext, device, renderPass, renderPassVK,
+                           VK_SUBPASS_CONTENTS_INLINE);
+}
+
 // static
 Ref<CommandBuffer> CommandBuffer::Create(CommandEncoder* encoder,
                                          const CommandBufferDescriptor* descriptor) {
@@ -606,6 +989,12 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
     size_t nextComputePassNumber = 0;
     size_t nextRenderPassNumber = 0;
 
+    std::vector<bool> renderPassesExecutingOnlyRecordableBundles;
+    if (device->IsToggleEnabled(Toggle::VulkanRecordRenderBundlesInSecondaryCommandBuffers)) {
+        renderPassesExecutingOnlyRecordableBundles =
+            FindRenderPassesExecutingOnlyRecordableBundles(device, &mCommands);
+    }
+
     Command type;
     while (mCommands.NextCommandId(&type)) {
         switch (type) {
@@ -623,8 +1012,10 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                 dstBuffer->EnsureDataInitializedAsDestination(recordingContext,
                                                               copy->destinationOffset, copy->size);
 
-                srcBuffer->TransitionUsageNow(recordingContext, wgpu::BufferUsage::CopySrc);
-                dstBuffer->TransitionUsageNow(recordingContext, wgpu::BufferUsage::CopyDst);
+                BarrierBatch* barriers = &recordingContext->barriers;
+                barriers->TransitionBuffer(recordingContext, srcBuffer, wgpu::BufferUsage::CopySrc);
+                barriers->TransitionBuffer(recordingContext, dstBuffer, wgpu::BufferUsage::CopyDst);
+                barriers->Record(device, recordingContext);
 
                 VkBufferCopy region;
                 region.srcOffset = copy->sourceOffset;
@@ -663,11 +1054,13 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                     DAWN_TRY(ToBackend(dst.texture)
                                  ->EnsureSubresourceContentInitialized(recordingContext, range));
                 }
-                ToBackend(src.buffer)
-                    ->TransitionUsageNow(recordingContext, wgpu::BufferUsage::CopySrc);
-                ToBackend(dst.texture)
-                    ->TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopyDst,
-                                         wgpu::ShaderStage::None, range);
+                BarrierBatch* barriers = &recordingContext->barriers;
+                barriers->TransitionBuffer(recordingContext, ToBackend(src.buffer),
+                                           wgpu::BufferUsage::CopySrc);
+                barriers->TransitionTexture(recordingContext, ToBackend(dst.texture),
+                                            wgpu::TextureUsage::CopyDst, wgpu::ShaderStage::None,
+                                            range);
+                barriers->Record(device, recordingContext);
                 VkBuffer srcBuffer = ToBackend(src.buffer)->GetHandle();
                 VkImage dstImage = ToBackend(dst.texture)->GetHandle();
 
@@ -698,11 +1091,13 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                 DAWN_TRY(ToBackend(src.texture)
                              ->EnsureSubresourceContentInitialized(recordingContext, range));
 
-                ToBackend(src.texture)
-                    ->TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopySrc,
-                                         wgpu::ShaderStage::None, range);
-                ToBackend(dst.buffer)
-                    ->TransitionUsageNow(recordingContext, wgpu::BufferUsage::CopyDst);
+                BarrierBatch* barriers = &recordingContext->barriers;
+                barriers->TransitionTexture(recordingContext, ToBackend(src.texture),
+                                            wgpu::TextureUsage::CopySrc, wgpu::ShaderStage::None,
+                                            range);
+                barriers->TransitionBuffer(recordingContext, ToBackend(dst.buffer),
+                                           wgpu::BufferUsage::CopyDst);
+                barriers->Record(device, recordingContext);
 
                 VkImage srcImage = ToBackend(src.texture)->GetHandle();
                 VkBuffer dstBuffer = ToBackend(dst.buffer)->GetHandle();
@@ -744,12 +1139,14 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                                                    copy->copySize.depthOrArrayLayers));
                 }
 
-                ToBackend(src.texture)
-                    ->TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopySrc,
-                                         wgpu::ShaderStage::None, srcRange);
-                ToBackend(dst.texture)
-                    ->TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopyDst,
-                                         wgpu::ShaderStage::None, dstRange);
+                BarrierBatch* barriers = &recordingContext->barriers;
+                barriers->TransitionTexture(recordingContext, ToBackend(src.texture),
+                                            wgpu::TextureUsage::CopySrc, wgpu::ShaderStage::None,
+                                            srcRange);
+                barriers->TransitionTexture(recordingContext, ToBackend(dst.texture),
+                                            wgpu::TextureUsage::CopyDst, wgpu::ShaderStage::None,
+                                            dstRange);
+                barriers->Record(device, recordingContext);
 
                 // In some situations we cannot do texture-to-texture copies with vkCmdCopyImage
                 // because as Vulkan SPEC always validates image copies with the virtual size of
@@ -819,7 +1216,10 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                     GetResourceUsages().renderPasses[nextRenderPassNumber]));
 
                 LazyClearRenderPassAttachments(cmd);
-                DAWN_TRY(RecordRenderPass(recordingContext, cmd));
+                bool executesOnlyRecordableBundles =
+                    nextRenderPassNumber < renderPassesExecutingOnlyRecordableBundles.size() &&
+                    renderPassesExecutingOnlyRecordableBundles[nextRenderPassNumber];
+                DAWN_TRY(RecordRenderPass(recordingContext, cmd, executesOnlyRecordableBundles));
 
                 recordingContext->hasRecordedRenderPass = true;
                 nextRenderPassNumber++;
@@ -1023,7 +1423,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
 
                 device->fn.CmdDispatch(commands, dispatch->x, dispatch->y, dispatch->z);
                 currentDispatch++;
@@ -1036,7 +1436,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
 
                 device->fn.CmdDispatchIndirect(commands, indirectBuffer,
                                                static_cast<VkDeviceSize>(dispatch->indirectOffset));
@@ -1136,7 +1536,8 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 }
 
 MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingContext,
-                                           BeginRenderPassCmd* renderPassCmd) {
+                                           BeginRenderPassCmd* renderPassCmd,
+                                           bool executesOnlyRecordableBundles) {
     Device* device = ToBackend(GetDevice());
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
@@ -1150,205 +1551,25 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
     }
 
-    DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
+    // Render passes that only execute render bundles execute the secondary command buffers in which
+    // the bundles are pre-recorded. Expanding the resolve targets draws at the start of the
+    // subpass, so these render passes are recorded inline instead.
+    bool useSecondaryCommandBuffers =
+        executesOnlyRecordableBundles &&
+        !renderPassCmd->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any();
 
-    // Set the default value for the dynamic state
-    {
-        device->fn.CmdSetLineWidth(commands, 1.0f);
-        device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
-
-        device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, 0);
-
-        float blendConstants[4] = {
-            0.0f,
-            0.0f,
-            0.0f,
-            0.0f,
-        };
-        device->fn.CmdSetBlendConstants(commands, blendConstants);
-
-        // The viewport and scissor default to cover all of the attachments
-        VkViewport viewport;
-        viewport.x = 0.0f;
-        viewport.y = static_cast<float>(renderPassCmd->height);
-        viewport.width = static_cast<float>(renderPassCmd->width);
-        viewport.height = -static_cast<float>(renderPassCmd->height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        device->fn.CmdSetViewport(commands, 0, 1, &viewport);
-
-        VkRect2D scissorRect;
-        scissorRect.offset.x = 0;
-        scissorRect.offset.y = 0;
-        scissorRect.extent.width = renderPassCmd->width;
-        scissorRect.extent.height = renderPassCmd->height;
-        device->fn.CmdSetScissor(commands, 0, 1, &scissorRect);
+    VkRenderPass renderPassVK = VK_NULL_HANDLE;
+    DAWN_TRY_ASSIGN(renderPassVK, QueryRenderPass(device, renderPassCmd));
+    if (useSecondaryCommandBuffers) {
+        DAWN_TRY(BeginRenderPass(recordingContext, device, renderPassCmd, renderPassVK,
+                                 VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS));
+    } else {
+        DAWN_TRY(BeginRenderPass(recordingContext, device, renderPassCmd, renderPassVK,
+                                 VK_SUBPASS_CONTENTS_INLINE));
+        RecordDefaultDynamicState(device, commands, renderPassCmd->width, renderPassCmd->height);
     }
 
-    DescriptorSetTracker descriptorSets = {};
-    RenderPipeline* lastPipeline = nullptr;
-
-    // Tracking for the push constants needed by the ClampFragDepth transform.
-    // TODO(dawn:1125): Avoid the need for this when the depthClamp feature is available, but doing
-    // so would require fixing issue dawn:1576 first to have more dynamic push constant usage. (and
-    // also additional tests that the dirtying logic here is correct so with a Toggle we can test it
-    // on our infra).
-    ClampFragDepthArgs clampFragDepthArgs = {0.0f, 1.0f};
-    bool clampFragDepthArgsDirty = true;
-    auto ApplyClampFragDepthArgs = [&] {
-        if (!clampFragDepthArgsDirty || lastPipeline == nullptr) {
-            return;
-        }
-        device->fn.CmdPushConstants(commands, ToBackend(lastPipeline->GetLayout())->GetHandle(),
-                                    VK_SHADER_STAGE_FRAGMENT_BIT, kClampFragDepthArgsOffset,
-                                    kClampFragDepthArgsSize, &clampFragDepthArgs);
-        clampFragDepthArgsDirty = false;
-    };
-
-    auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) {
-        switch (type) {
-            case Command::Draw: {
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount,
-                                   draw->firstVertex, draw->firstInstance);
-                break;
-            }
-
-            case Command::DrawIndexed: {
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
-                                          draw->firstIndex, draw->baseVertex, draw->firstInstance);
-                break;
-            }
-
-            case Command::DrawIndirect: {
-                DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndirect(commands, buffer->GetHandle(),
-                                           static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
-                break;
-            }
-
-            case Command::DrawIndexedIndirect: {
-                DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-                DAWN_ASSERT(buffer != nullptr);
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                device->fn.CmdDrawIndexedIndirect(commands, buffer->GetHandle(),
-                                                  static_cast<VkDeviceSize>(draw->indirectOffset),
-                                                  1, 0);
-                break;
-            }
-
-            case Command::InsertDebugMarker: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdInsertDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::InsertDebugMarker);
-                }
-                break;
-            }
-
-            case Command::PopDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    iter->NextCommand<PopDebugGroupCmd>();
-                    device->fn.CmdEndDebugUtilsLabelEXT(commands);
-                } else {
-                    SkipCommand(iter, Command::PopDebugGroup);
-                }
-                break;
-            }
-
-            case Command::PushDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdBeginDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::PushDebugGroup);
-                }
-                break;
-            }
-
-            case Command::SetBindGroup: {
-                SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
-                BindGroup* bindGroup = ToBackend(cmd->group.Get());
-                uint32_t* dynamicOffsets = nullptr;
-                if (cmd->dynamicOffsetCount > 0) {
-                    dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
-                }
-
-                descriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
-                                              dynamicOffsets);
-                break;
-            }
-
-            case Command::SetIndexBuffer: {
-                SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
-                VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
-
-                device->fn.CmdBindIndexBuffer(commands, indexBuffer, cmd->offset,
-                                              VulkanIndexType(cmd->format));
-                break;
-            }
-
-            case Command::SetRenderPipeline: {
-                SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
-
-                device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                           pipeline->GetHandle());
-                lastPipeline = pipeline;
-
-                descriptorSets.OnSetPipeline(pipeline);
-
-                // Apply the deferred min/maxDepth push constants update if needed.
-                ApplyClampFragDepthArgs();
-                break;
-            }
-
-            case Command::SetVertexBuffer: {
-                SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
-                VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
-                VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
-
-                device->fn.CmdBindVertexBuffers(commands, static_cast<uint8_t>(cmd->slot), 1,
-                                                &*buffer, &offset);
-                break;
-            }
-
-            default:
-                DAWN_UNREACHABLE();
-                break;
-        }
-    };
+    RenderCommandRecorder recorder(device, commands);
 
     Command type;
     while (mCommands.NextCommandId(&type)) {
@@ -1407,12 +1628,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                 }
 
                 device->fn.CmdSetViewport(commands, 0, 1, &viewport);
-
-                // Try applying the push constants that contain min/maxDepth immediately. This can
-                // be deferred if no pipeline is currently bound.
-                clampFragDepthArgs = {viewport.minDepth, viewport.maxDepth};
-                clampFragDepthArgsDirty = true;
-                ApplyClampFragDepthArgs();
+                recorder.SetClampFragDepthArgs(viewport.minDepth, viewport.maxDepth);
                 break;
             }
 
@@ -1432,11 +1648,30 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                 ExecuteBundlesCmd* cmd = mCommands.NextCommand<ExecuteBundlesCmd>();
                 auto bundles = mCommands.NextData<Ref<RenderBundleBase>>(cmd->count);
 
+                if (useSecondaryCommandBuffers) {
+                    if (cmd->count == 0) {
+                        break;
+                    }
+
+                    std::vector<VkCommandBuffer> bundleCommandBuffers(cmd->count);
+                    for (uint32_t i = 0; i < cmd->count; ++i) {
+                        RenderBundleBase* bundle = bundles[i].Get();
+                        DAWN_TRY_ASSIGN(
+                            bundleCommandBuffers[i],
+                            RenderBundleCommandBuffers::Get(device, bundle)
+                                ->GetOrRecord(bundle, renderPassVK, renderPassCmd->width,
+                                              renderPassCmd->height));
+                    }
+                    device->fn.CmdExecuteCommands(commands, cmd->count,
+                                                  bundleCommandBuffers.data());
+                    break;
+                }
+
                 for (uint32_t i = 0; i < cmd->count; ++i) {
                     CommandIterator* iter = bundles[i]->GetCommands();
                     iter->Reset();
                     while (iter->NextCommandId(&type)) {
-                        EncodeRenderBundleCommand(iter, type);
+                        recorder.RecordCommand(iter, type);
                     }
                 }
                 break;
@@ -1467,7 +1702,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
             }
 
             default: {
-                EncodeRenderBundleCommand(&mCommands, type);
+                recorder.RecordCommand(&mCommands, type);
                 break;
             }
         }
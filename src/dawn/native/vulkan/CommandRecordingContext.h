@@ -31,6 +31,7 @@
 
 #include "absl/container/flat_hash_set.h"
 #include "dawn/common/vulkan_platform.h"
+#include "dawn/native/vulkan/BarrierBatch.h"
 #include "dawn/native/vulkan/BufferVk.h"
 #include "dawn/native/vulkan/VulkanFunctions.h"
 
@@ -48,12 +49,15 @@ struct CommandPoolAndBuffer {
 };
 
 // Used to track operations that are handled after recording.
-// Currently only tracks semaphores, but may be used to do barrier coalescing in the future.
 struct CommandRecordingContext {
     VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
     std::vector<VkSemaphore> waitSemaphores = {};
     std::vector<VkSemaphore> signalSemaphores = {};
 
+    // Used to coalesce the barriers of resource transitions that are recorded together. It must
+    // be empty outside of the recording of a group of transitions.
+    BarrierBatch barriers;
+
     // The internal buffers used in the workaround of texture-to-texture copies with compressed
     // formats.
     std::vector<Ref<Buffer>> tempBuffers;
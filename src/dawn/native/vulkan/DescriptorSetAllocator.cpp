@@ -40,6 +40,19 @@ namespace dawn::native::vulkan {
 // TODO(enga): Figure out this value.
 static constexpr uint32_t kMaxDescriptorsPerPool = 512;
 
+DescriptorSetContents::DescriptorSetContents() = default;
+
+DescriptorSetContents::~DescriptorSetContents() = default;
+
+DescriptorSetContents::DescriptorSetContents(DescriptorSetContents&&) = default;
+
+DescriptorSetContents& DescriptorSetContents::operator=(DescriptorSetContents&&) = default;
+
+bool DescriptorSetContents::operator==(const DescriptorSetContents& other) const {
+    return hash == other.hash && objects == other.objects &&
+           bufferOffsetsAndSizes == other.bufferOffsetsAndSizes;
+}
+
 // static
 Ref<DescriptorSetAllocator> DescriptorSetAllocator::Create(
     DeviceBase* device,
@@ -115,30 +128,103 @@ ResultOrError<DescriptorSetAllocation> DescriptorSetAllocator::Allocate(BindGrou
     return DescriptorSetAllocation{pool->sets[setIndex], poolIndex, setIndex};
 }
 
+std::optional<DescriptorSetAllocation> DescriptorSetAllocator::AllocateWithContents(
+    const DescriptorSetContents& contents) {
+    auto bucket = mReusableSets.find(contents.hash);
+    if (bucket == mReusableSets.end()) {
+        return {};
+    }
+
+    std::vector<ReusableSet>& sets = bucket->second;
+    for (auto it = sets.begin(); it != sets.end(); ++it) {
+        if (it->contents == contents) {
+            // The pending deallocation of the set is skipped in FinishDeallocation because the
+            // set is no longer in mReusableSets.
+            DescriptorSetAllocation allocation = {
+                mDescriptorPools[it->poolIndex].sets[it->setIndex], it->poolIndex, it->setIndex};
+            sets.erase(it);
+            if (sets.empty()) {
+                mReusableSets.erase(bucket);
+            }
+            return allocation;
+        }
+    }
+    return {};
+}
+
 void DescriptorSetAllocator::Deallocate(DescriptorSetAllocation* allocationInfo) {
     DAWN_ASSERT(allocationInfo != nullptr);
     DAWN_ASSERT(allocationInfo->set != VK_NULL_HANDLE);
 
+    EnqueueDeallocation(allocationInfo->poolIndex, allocationInfo->setIndex, std::nullopt);
+
+    // Clear the content of allocation so that use after frees are more visible.
+    *allocationInfo = {};
+}
+
+void DescriptorSetAllocator::Deallocate(DescriptorSetAllocation* allocationInfo,
+                                        DescriptorSetContents contents) {
+    DAWN_ASSERT(allocationInfo != nullptr);
+    DAWN_ASSERT(allocationInfo->set != VK_NULL_HANDLE);
+
+    const size_t hash = contents.hash;
+    ExecutionSerial serial =
+        EnqueueDeallocation(allocationInfo->poolIndex, allocationInfo->setIndex, hash);
+    mReusableSets[hash].push_back(
+        {std::move(contents), allocationInfo->poolIndex, allocationInfo->setIndex, serial});
+
+    // Clear the content of allocation so that use after frees are more visible.
+    *allocationInfo = {};
+}
+
+ExecutionSerial DescriptorSetAllocator::EnqueueDeallocation(PoolIndex poolIndex,
+                                                            SetIndex setIndex,
+                                                            std::optional<size_t> contentsHash) {
     // We can't reuse the descriptor set right away because the Vulkan spec says in the
     // documentation for vkCmdBindDescriptorSets that the set may be consumed any time between
     // host execution of the command and the end of the draw/dispatch.
     Device* device = ToBackend(GetDevice());
     const ExecutionSerial serial = device->GetQueue()->GetPendingCommandSerial();
-    mPendingDeallocations.Enqueue({allocationInfo->poolIndex, allocationInfo->setIndex}, serial);
+    mPendingDeallocations.Enqueue({poolIndex, setIndex, contentsHash, serial}, serial);
 
     if (mLastDeallocationSerial != serial) {
         device->EnqueueDeferredDeallocation(this);
         mLastDeallocationSerial = serial;
     }
+    return serial;
+}
 
-    // Clear the content of allocation so that use after frees are more visible.
-    *allocationInfo = {};
+bool DescriptorSetAllocator::RemoveReusableSet(const Deallocation& dealloc) {
+    auto bucket = mReusableSets.find(*dealloc.contentsHash);
+    if (bucket == mReusableSets.end()) {
+        return false;
+    }
+
+    std::vector<ReusableSet>& sets = bucket->second;
+    for (auto it = sets.begin(); it != sets.end(); ++it) {
+        // The set may have been reused and deallocated again at a later serial, in which case
+        // it must stay alive until that later deallocation is finished.
+        if (it->poolIndex == dealloc.poolIndex && it->setIndex == dealloc.setIndex &&
+            it->deallocationSerial == dealloc.serial) {
+            sets.erase(it);
+            if (sets.empty()) {
+                mReusableSets.erase(bucket);
+            }
+            return true;
+        }
+    }
+    return false;
 }
 
 void DescriptorSetAllocator::FinishDeallocation(ExecutionSerial completedSerial) {
     for (const Deallocation& dealloc : mPendingDeallocations.IterateUpTo(completedSerial)) {
         DAWN_ASSERT(dealloc.poolIndex < mDescriptorPools.size());
 
+        if (dealloc.contentsHash.has_value() && !RemoveReusableSet(dealloc)) {
+            // The descriptor set was reused by AllocateWithContents and is still in use.
+            continue;
+        }
+
         auto& freeSetIndices = mDescriptorPools[dealloc.poolIndex].freeSetIndices;
         if (freeSetIndices.empty()) {
             mAvailableDescriptorPoolIndices.emplace_back(dealloc.poolIndex);
@@ -28,9 +28,11 @@
 #ifndef SRC_DAWN_NATIVE_VULKAN_DESCRIPTORSETALLOCATOR_H_
 #define SRC_DAWN_NATIVE_VULKAN_DESCRIPTORSETALLOCATOR_H_
 
+#include <optional>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "dawn/common/Ref.h"
 #include "dawn/common/SerialQueue.h"
 #include "dawn/common/vulkan_platform.h"
 #include "dawn/native/Error.h"
@@ -43,6 +45,23 @@ namespace dawn::native::vulkan {
 
 class BindGroupLayout;
 
+// The objects and buffer ranges written in a descriptor set, used to find released descriptor
+// sets that can be reused without being written again. Holding references to the objects
+// guarantees that they aren't replaced by other objects at the same address while the contents
+// are used as a key.
+struct DescriptorSetContents {
+    DescriptorSetContents();
+    ~DescriptorSetContents();
+    DescriptorSetContents(DescriptorSetContents&&);
+    DescriptorSetContents& operator=(DescriptorSetContents&&);
+
+    bool operator==(const DescriptorSetContents& other) const;
+
+    std::vector<Ref<ObjectBase>> objects;
+    std::vector<uint64_t> bufferOffsetsAndSizes;
+    size_t hash = 0;
+};
+
 class DescriptorSetAllocator : public ObjectBase {
     using PoolIndex = uint32_t;
     using SetIndex = uint16_t;
@@ -53,7 +72,14 @@ class DescriptorSetAllocator : public ObjectBase {
         absl::flat_hash_map<VkDescriptorType, uint32_t> descriptorCountPerType);
 
     ResultOrError<DescriptorSetAllocation> Allocate(BindGroupLayout* layout);
+    // Returns a descriptor set that was deallocated with the same contents and is still waiting
+    // for the GPU to be done with it, if any. Its descriptors don't need to be written again.
+    std::optional<DescriptorSetAllocation> AllocateWithContents(
+        const DescriptorSetContents& contents);
     void Deallocate(DescriptorSetAllocation* allocationInfo);
+    // Same as Deallocate, but the descriptor set can be returned by AllocateWithContents until
+    // the deallocation is finished.
+    void Deallocate(DescriptorSetAllocation* allocationInfo, DescriptorSetContents contents);
     void FinishDeallocation(ExecutionSerial completedSerial);
 
   private:
@@ -62,6 +88,9 @@ class DescriptorSetAllocator : public ObjectBase {
     ~DescriptorSetAllocator() override;
 
     MaybeError AllocateDescriptorPool(BindGroupLayout* layout);
+    ExecutionSerial EnqueueDeallocation(PoolIndex poolIndex,
+                                        SetIndex setIndex,
+                                        std::optional<size_t> contentsHash);
 
     std::vector<VkDescriptorPoolSize> mPoolSizes;
     SetIndex mMaxSets;
@@ -78,9 +107,24 @@ class DescriptorSetAllocator : public ObjectBase {
     struct Deallocation {
         PoolIndex poolIndex;
         SetIndex setIndex;
+        // Set when the descriptor set is also in mReusableSets. In that case the set is only
+        // freed if it wasn't reused in the meantime.
+        std::optional<size_t> contentsHash;
+        ExecutionSerial serial;
     };
     SerialQueue<ExecutionSerial, Deallocation> mPendingDeallocations;
     ExecutionSerial mLastDeallocationSerial = ExecutionSerial(0);
+
+    struct ReusableSet {
+        DescriptorSetContents contents;
+        PoolIndex poolIndex;
+        SetIndex setIndex;
+        ExecutionSerial deallocationSerial;
+    };
+    // Descriptor sets pending deallocation, bucketed by the hash of their contents.
+    absl::flat_hash_map<size_t, std::vector<ReusableSet>> mReusableSets;
+    // Removes the set of `dealloc` from mReusableSets. Returns false if it was reused instead.
+    bool RemoveReusableSet(const Deallocation& dealloc);
 };
 
 }  // namespace dawn::native::vulkan
@@ -36,6 +36,7 @@ FencedDeleter::FencedDeleter(Device* device) : mDevice(device) {}
 
 FencedDeleter::~FencedDeleter() {
     DAWN_ASSERT(mBuffersToDelete.Empty());
+    DAWN_ASSERT(mCommandPoolsToDelete.Empty());
     DAWN_ASSERT(mDescriptorPoolsToDelete.Empty());
     DAWN_ASSERT(mFramebuffersToDelete.Empty());
     DAWN_ASSERT(mImagesToDelete.Empty());
@@ -57,6 +58,10 @@ void FencedDeleter::DeleteWhenUnused(VkBuffer buffer) {
     mBuffersToDelete.Enqueue(buffer, mDevice->GetQueue()->GetPendingCommandSerial());
 }
 
+void FencedDeleter::DeleteWhenUnused(VkCommandPool pool) {
+    mCommandPoolsToDelete.Enqueue(pool, mDevice->GetQueue()->GetPendingCommandSerial());
+}
+
 void FencedDeleter::DeleteWhenUnused(VkDescriptorPool pool) {
     mDescriptorPoolsToDelete.Enqueue(pool, mDevice->GetQueue()->GetPendingCommandSerial());
 }
@@ -183,6 +188,12 @@ void FencedDeleter::Tick(ExecutionSerial completedSerial) {
     }
     mSemaphoresToDelete.ClearUpTo(completedSerial);
 
+    // Destroying a command pool frees the command buffers allocated from it.
+    for (VkCommandPool pool : mCommandPoolsToDelete.IterateUpTo(completedSerial)) {
+        mDevice->fn.DestroyCommandPool(vkDevice, pool, nullptr);
+    }
+    mCommandPoolsToDelete.ClearUpTo(completedSerial);
+
     for (VkDescriptorPool pool : mDescriptorPoolsToDelete.IterateUpTo(completedSerial)) {
         mDevice->fn.DestroyDescriptorPool(vkDevice, pool, nullptr);
     }
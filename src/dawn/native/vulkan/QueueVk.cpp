@@ -457,7 +457,10 @@ MaybeError Queue::SubmitPendingCommands() {
     }
     DAWN_ASSERT(externalTextureSemaphoreIter == externalTextureSemaphores.end());
 
+    // Keep the storage of the barrier batch for the next recording context.
+    BarrierBatch barriers = std::move(mRecordingContext.barriers);
     mRecordingContext = CommandRecordingContext();
+    mRecordingContext.barriers = std::move(barriers);
     DAWN_TRY(PrepareRecordingContext());
 
     return {};
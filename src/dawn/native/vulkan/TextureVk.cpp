@@ -1466,12 +1466,8 @@ void Texture::TransitionUsageNow(CommandRecordingContext* recordingContext,
     VkPipelineStageFlags srcStages = 0;
     VkPipelineStageFlags dstStages = 0;
 
-    TransitionUsageAndGetResourceBarrier(usage, shaderStages, range, &barriers, &srcStages,
-                                         &dstStages);
-
-    if (mExternalState != ExternalState::InternalOnly) {
-        TweakTransitionForExternalUsage(recordingContext, &barriers, 0);
-    }
+    TransitionUsageAndGetResourceBarriers(recordingContext, usage, shaderStages, range, &barriers,
+                                          &srcStages, &dstStages);
 
     if (!barriers.empty()) {
         DAWN_ASSERT(srcStages != 0 && dstStages != 0);
@@ -1481,6 +1477,24 @@ void Texture::TransitionUsageNow(CommandRecordingContext* recordingContext,
     }
 }
 
+void Texture::TransitionUsageAndGetResourceBarriers(
+    CommandRecordingContext* recordingContext,
+    wgpu::TextureUsage usage,
+    wgpu::ShaderStage shaderStages,
+    const SubresourceRange& range,
+    std::vector<VkImageMemoryBarrier>* imageBarriers,
+    VkPipelineStageFlags* srcStages,
+    VkPipelineStageFlags* dstStages) {
+    size_t transitionBarrierStart = imageBarriers->size();
+
+    TransitionUsageAndGetResourceBarrier(usage, shaderStages, range, imageBarriers, srcStages,
+                                         dstStages);
+
+    if (mExternalState != ExternalState::InternalOnly) {
+        TweakTransitionForExternalUsage(recordingContext, imageBarriers, transitionBarrierStart);
+    }
+}
+
 void Texture::UpdateUsage(wgpu::TextureUsage usage,
                           wgpu::ShaderStage shaderStages,
                           const SubresourceRange& range) {
@@ -98,11 +98,19 @@ class Texture final : public TextureBase {
 
     // Transitions the texture to be used as `usage`, recording any necessary barrier in
     // `commands`.
-    // TODO(crbug.com/dawn/851): coalesce barriers and do them early when possible.
     void TransitionUsageNow(CommandRecordingContext* recordingContext,
                             wgpu::TextureUsage usage,
                             wgpu::ShaderStage shaderStages,
                             const SubresourceRange& range);
+    // Transitions the texture to be used as `usage`, appending any necessary barrier to
+    // `imageBarriers` so that it can be recorded together with other barriers.
+    void TransitionUsageAndGetResourceBarriers(CommandRecordingContext* recordingContext,
+                                               wgpu::TextureUsage usage,
+                                               wgpu::ShaderStage shaderStages,
+                                               const SubresourceRange& range,
+                                               std::vector<VkImageMemoryBarrier>* imageBarriers,
+                                               VkPipelineStageFlags* srcStages,
+                                               VkPipelineStageFlags* dstStages);
     void TransitionUsageForPass(CommandRecordingContext* recordingContext,
                                 const TextureSubresourceSyncInfo& textureSyncInfos,
                                 std::vector<VkImageMemoryBarrier>* imageBarriers,
@@ -32,42 +32,110 @@
 
 namespace wgpu::binding {
 
-AsyncRunner::AsyncRunner(dawn::native::Instance* instance) : instance_(instance) {}
+namespace {
+
+constexpr uint64_t kInfiniteTimeoutNS = std::numeric_limits<uint64_t>::max();
+
+}  // namespace
+
+AsyncRunner::AsyncRunner(dawn::native::Instance* instance) : instance_(instance->Get()) {}
+
+AsyncRunner::~AsyncRunner() {
+    // The futures of the helper threads own AsyncContexts, which keep the AsyncRunner alive, so
+    // the threads have waited on all of their futures and are about to exit.
+    std::unordered_map<WGPUQueue, std::unique_ptr<QueueWaiter>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters = std::move(waiters_);
+    }
+    for (auto& [_, waiter] : waiters) {
+        if (waiter->thread.joinable()) {
+            waiter->thread.join();
+        }
+    }
+    if (env_ != nullptr) {
+        wake_.Release();
+    }
+}
 
 void AsyncRunner::Begin(Napi::Env env) {
     assert(count_ != std::numeric_limits<decltype(count_)>::max());
+    if (env_ == nullptr) {
+        env_ = env;
+        wake_ = Napi::ThreadSafeFunction::New(
+            env, Napi::Function::New(env, [](const Napi::CallbackInfo&) {}),
+            "dawn.node AsyncRunner", /* maxQueueSize */ 0, /* initialThreadCount */ 1);
+        wake_.Unref(env);
+    }
     if (count_++ == 0) {
-        QueueTick(env);
+        // Keep the event loop alive while there are tasks in flight.
+        wake_.Ref(env);
     }
 }
 
 void AsyncRunner::End() {
     assert(count_ > 0);
-    count_--;
+    if (--count_ == 0) {
+        wake_.Unref(env_);
+    }
 }
 
-void AsyncRunner::QueueTick(Napi::Env env) {
-    // TODO(crbug.com/dawn/1127): We probably want to reduce the frequency at which this gets
-    // called.
-    if (tick_queued_) {
-        return;
+void AsyncRunner::Wait(const wgpu::Queue& queue, wgpu::Future future) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Join the helper threads that have exited, so that queues that are done with don't keep
+    // their thread around.
+    for (auto it = waiters_.begin(); it != waiters_.end();) {
+        if (!it->second->running) {
+            if (it->second->thread.joinable()) {
+                it->second->thread.join();
+            }
+            it = waiters_.erase(it);
+        } else {
+            ++it;
+        }
     }
-    tick_queued_ = true;
-    env.Global()
-        .Get("setImmediate")
-        .As<Napi::Function>()
-        .Call({
-            // TODO(crbug.com/dawn/1127): Create once, reuse.
-            Napi::Function::New(env,
-                                [this, env](const Napi::CallbackInfo&) {
-                                    tick_queued_ = false;
-                                    if (count_ > 0) {
-                                        wgpu::Instance instance = instance_->Get();
-                                        instance.ProcessEvents();
-                                        QueueTick(env);
-                                    }
-                                }),
-        });
+
+    std::unique_ptr<QueueWaiter>& waiter = waiters_[queue.Get()];
+    if (waiter == nullptr) {
+        waiter = std::make_unique<QueueWaiter>();
+    }
+    waiter->futures.push_back(future);
+    if (!waiter->running) {
+        waiter->running = true;
+        waiter->thread = std::thread([this, waiter = waiter.get()] { WaitLoop(waiter); });
+    }
+}
+
+void AsyncRunner::PostImpl(std::function<void()> task) {
+    // The task owns the AsyncContext of the completed task, which holds JavaScript references, so
+    // it must only be destroyed on the JavaScript thread. If the call can't be queued because the
+    // environment is closing, the task is leaked on purpose instead of being destroyed here.
+    // Node-API also skips calls that are still queued when the environment is torn down.
+    auto* owned = new std::function<void()>(std::move(task));
+    wake_.NonBlockingCall([owned](Napi::Env, Napi::Function) {
+        (*owned)();
+        delete owned;
+    });
+}
+
+void AsyncRunner::WaitLoop(QueueWaiter* waiter) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!waiter->futures.empty()) {
+        // The futures of a queue complete in the order they were created, so block on the
+        // oldest one until it completes. The callbacks of the futures are spontaneous, so they
+        // fire on this thread (or wherever the future completes) and post their completion to
+        // the JavaScript thread.
+        wgpu::FutureWaitInfo info{waiter->futures.front()};
+        lock.unlock();
+        [[maybe_unused]] wgpu::WaitStatus status = instance_.WaitAny(1, &info, kInfiniteTimeoutNS);
+        assert(status == wgpu::WaitStatus::Success);
+        lock.lock();
+
+        // Only this thread removes futures, so the front is still the future that was waited on.
+        waiter->futures.pop_front();
+    }
+    waiter->running = false;
 }
 
 void AsyncRunner::Reject(Napi::Env env, interop::Promise<void> promise, Napi::Error error) {
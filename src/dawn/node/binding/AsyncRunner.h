@@ -29,7 +29,13 @@
 #define SRC_DAWN_NODE_BINDING_ASYNCRUNNER_H_
 
 #include <stdint.h>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 #include "dawn/native/DawnNative.h"
@@ -39,23 +45,43 @@
 
 namespace wgpu::binding {
 
-// AsyncRunner is used to poll a wgpu::Device with calls to Tick() while there are asynchronous
-// tasks in flight.
+// AsyncRunner is used to wait on the wgpu::Futures of the asynchronous tasks in flight, and to run
+// their completion on the main JavaScript thread.
+// Tasks use wgpu::CallbackMode::AllowSpontaneous callbacks which Post() the JavaScript side of the
+// completion back to the main thread, waking the event loop only when something has actually
+// completed. Futures that complete with the work of a queue (buffer mapping, onSubmittedWorkDone)
+// only complete when they are waited on, so they are handed to Wait(). Each queue gets a helper
+// thread that blocks in wgpu::Instance::WaitAny() on its futures instead of polling. Other futures
+// complete, and call their callback, on their own.
 class AsyncRunner {
   public:
     explicit AsyncRunner(dawn::native::Instance* instance);
+    ~AsyncRunner();
 
     // Begin() should be called when a new asynchronous task is started.
-    // If the number of executing asynchronous tasks transitions from 0 to 1, then a function
-    // will be scheduled on the main JavaScript thread to call wgpu::Device::Tick() whenever the
-    // thread is idle. This will be repeatedly called until the number of executing asynchronous
-    // tasks reaches 0 again.
+    // While there are executing asynchronous tasks, the AsyncRunner keeps the JavaScript event
+    // loop alive so that the completion of the tasks can be posted to it.
     void Begin(Napi::Env env);
 
     // End() should be called once the asynchronous task has finished.
     // Every call to Begin() should eventually result in a call to End().
     void End();
 
+    // Wait() hands the future to the helper thread of `queue`, which waits on it until it
+    // completes. The future must complete with the work of `queue` submitted so far, as the
+    // futures of the queue are waited on in order. Must be called on the main JavaScript thread,
+    // for a future whose callback was registered with wgpu::CallbackMode::AllowSpontaneous.
+    void Wait(const wgpu::Queue& queue, wgpu::Future future);
+
+    // Post() schedules the task to be called on the main JavaScript thread. Post() can be called
+    // from any thread, and is used by the spontaneous callbacks of the asynchronous tasks. As the
+    // AsyncContext of a task keeps the AsyncRunner alive, callbacks only need to hold a raw
+    // pointer to the AsyncRunner until they have posted their AsyncContext.
+    template <typename F>
+    void Post(F&& task) {
+        PostImpl([task = std::make_shared<std::decay_t<F>>(std::forward<F>(task))] { (*task)(); });
+    }
+
     // Rejects the promise after the current task in the event loop. This is useful to preserve
     // some of the semantics of WebGPU w.r.t. the JavaScript event loop. Reject() can be called
     // any time, but callers need to make sure that the Promise is (rejected or resolved) only
@@ -63,11 +89,28 @@ class AsyncRunner {
     void Reject(Napi::Env env, interop::Promise<void> promise, Napi::Error error);
 
   private:
-    void QueueTick(Napi::Env env);
-
-    const dawn::native::Instance* const instance_;
+    // The futures of a queue, and the helper thread waiting on them. The thread exits once it has
+    // waited on all the futures of the queue.
+    struct QueueWaiter {
+        std::deque<wgpu::Future> futures;
+        std::thread thread;
+        bool running = false;
+    };
+
+    void PostImpl(std::function<void()> task);
+    void WaitLoop(QueueWaiter* waiter);
+
+    const wgpu::Instance instance_;
     uint64_t count_ = 0;
-    bool tick_queued_ = false;
+
+    // Wakes up the JavaScript event loop to run the tasks given to Post().
+    // Created by the first call to Begin().
+    napi_env env_ = nullptr;
+    Napi::ThreadSafeFunction wake_;
+
+    // State shared with the helper threads.
+    std::mutex mutex_;
+    std::unordered_map<WGPUQueue, std::unique_ptr<QueueWaiter>> waiters_;
 };
 
 // AsyncTask is a RAII helper for calling AsyncRunner::Begin() on construction, and
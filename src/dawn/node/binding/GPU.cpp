@@ -130,6 +130,8 @@ GPU::GPU(Flags flags) : flags_(std::move(flags)) {
 
     wgpu::InstanceDescriptor desc;
     desc.nextInChain = &togglesDesc;
+    // Used by the AsyncRunner to block on futures instead of polling them.
+    desc.features.timedWaitAnyEnable = true;
     instance_ = std::make_unique<dawn::native::Instance>(
         reinterpret_cast<const WGPUInstanceDescriptor*>(&desc));
     async_ = std::make_shared<AsyncRunner>(instance_.get());
@@ -29,6 +29,7 @@
 
 #include <limits>
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -184,6 +185,9 @@ interop::Promise<interop::Interface<interop::GPUDevice>> GPUAdapter::requestDevi
 
         requiredFeatures.emplace_back(feature);
     }
+    // The AsyncRunner waits on the device's futures from a helper thread, concurrently with the
+    // JavaScript thread using the device.
+    requiredFeatures.emplace_back(wgpu::FeatureName::ImplicitDeviceSynchronization);
     if (!conv(desc.label, descriptor.label)) {
         return {env, interop::kUnusedPromise};
     }
@@ -222,8 +226,9 @@ interop::Promise<interop::Interface<interop::GPUDevice>> GPUAdapter::requestDevi
     auto device_lost_promise = device_lost_ctx->promise;
     desc.SetDeviceLostCallback(
         wgpu::CallbackMode::AllowSpontaneous,
-        [](const wgpu::Device&, wgpu::DeviceLostReason reason, const char* message,
-           DeviceLostContext* device_lost_ctx) {
+        [device_lost_ctx, async = async_.get()](const wgpu::Device&,
+                                                wgpu::DeviceLostReason reason,
+                                                const char* message) {
             std::unique_ptr<DeviceLostContext> ctx(device_lost_ctx);
             auto r = interop::GPUDeviceLostReason::kDestroyed;
             switch (reason) {
@@ -236,12 +241,14 @@ interop::Promise<interop::Interface<interop::GPUDevice>> GPUAdapter::requestDevi
                     r = interop::GPUDeviceLostReason::kUnknown;
                     break;
             }
-            if (ctx->promise.GetState() == interop::PromiseState::Pending) {
-                ctx->promise.Resolve(
-                    interop::GPUDeviceLostInfo::Create<GPUDeviceLostInfo>(ctx->env, r, message));
-            }
-        },
-        device_lost_ctx);
+            // The device may be lost on any thread, resolve the promise on the JavaScript thread.
+            async->Post([ctx = std::move(ctx), r, message = std::string(message ? message : "")] {
+                if (ctx->promise.GetState() == interop::PromiseState::Pending) {
+                    ctx->promise.Resolve(interop::GPUDeviceLostInfo::Create<GPUDeviceLostInfo>(
+                        ctx->env, r, message));
+                }
+            });
+        });
     desc.SetUncapturedErrorCallback([](const wgpu::Device&, ErrorType type, const char* message) {
         printf("%s:\n", str(type));
         chunkedWrite(message);
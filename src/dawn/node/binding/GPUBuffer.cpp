@@ -74,37 +74,40 @@ interop::Promise<void> GPUBuffer::mapAsync(Napi::Env env,
     auto ctx = std::make_unique<AsyncContext<void>>(env, PROMISE_INFO, async_);
     pending_map_.emplace(ctx->promise);
 
-    buffer_.MapAsync(
-        mode, offset, rangeSize, wgpu::CallbackMode::AllowProcessEvents,
-        [ctx = std::move(ctx), this](wgpu::MapAsyncStatus status, char const*) {
-            // The promise may already have been resolved with an AbortError if there was an early
-            // destroy() or early unmap().
-            if (ctx->promise.GetState() != interop::PromiseState::Pending) {
-                assert(ctx->promise.GetState() == interop::PromiseState::Rejected);
-                return;
-            }
-
-            switch (status) {
-                case wgpu::MapAsyncStatus::Success:
-                    ctx->promise.Resolve();
-                    mapped_ = true;
-                    break;
-                case wgpu::MapAsyncStatus::InstanceDropped:
-                case wgpu::MapAsyncStatus::Aborted:
-                    async_->Reject(ctx->env, ctx->promise, Errors::AbortError(ctx->env));
-                    break;
-                case wgpu::MapAsyncStatus::Error:
-                case wgpu::MapAsyncStatus::Unknown:
-                default:
-                    async_->Reject(ctx->env, ctx->promise, Errors::OperationError(ctx->env));
-                    break;
-            }
-
-            // This captured promise is the currently pending mapping, reset it so we can start new
-            // mappings.
-            assert(*pending_map_ == ctx->promise);
-            pending_map_.reset();
+    auto future = buffer_.MapAsync(
+        mode, offset, rangeSize, wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx), this](wgpu::MapAsyncStatus status, char const*) mutable {
+            async_->Post([ctx = std::move(ctx), this, status] {
+                // The promise may already have been resolved with an AbortError if there was an
+                // early destroy() or early unmap().
+                if (ctx->promise.GetState() != interop::PromiseState::Pending) {
+                    assert(ctx->promise.GetState() == interop::PromiseState::Rejected);
+                    return;
+                }
+
+                switch (status) {
+                    case wgpu::MapAsyncStatus::Success:
+                        ctx->promise.Resolve();
+                        mapped_ = true;
+                        break;
+                    case wgpu::MapAsyncStatus::InstanceDropped:
+                    case wgpu::MapAsyncStatus::Aborted:
+                        async_->Reject(ctx->env, ctx->promise, Errors::AbortError(ctx->env));
+                        break;
+                    case wgpu::MapAsyncStatus::Error:
+                    case wgpu::MapAsyncStatus::Unknown:
+                    default:
+                        async_->Reject(ctx->env, ctx->promise, Errors::OperationError(ctx->env));
+                        break;
+                }
+
+                // This captured promise is the currently pending mapping, reset it so we can start
+                // new mappings.
+                assert(*pending_map_ == ctx->promise);
+                pending_map_.reset();
+            });
         });
+    async_->Wait(device_.GetQueue(), future);
 
     return pending_map_.value();
 }
@@ -28,6 +28,7 @@
 #include "src/dawn/node/binding/GPUDevice.h"
 
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -389,18 +390,24 @@ GPUDevice::createComputePipelineAsync(Napi::Env env,
     auto promise = ctx->promise;
 
     device_.CreateComputePipelineAsync(
-        &desc, wgpu::CallbackMode::AllowProcessEvents,
-        [ctx = std::move(ctx), label = std::string(desc.label ? desc.label : "")](
-            wgpu::CreatePipelineAsyncStatus status, wgpu::ComputePipeline pipeline, char const*) {
-            switch (status) {
-                case wgpu::CreatePipelineAsyncStatus::Success:
-                    ctx->promise.Resolve(interop::GPUComputePipeline::Create<GPUComputePipeline>(
-                        ctx->env, pipeline, label));
-                    break;
-                default:
-                    ctx->promise.Reject(Errors::GPUPipelineError(ctx->env));
-                    break;
-            }
+        &desc, wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx), async = async_.get(),
+         label = std::string(desc.label ? desc.label : "")](
+            wgpu::CreatePipelineAsyncStatus status, wgpu::ComputePipeline pipeline,
+            char const*) mutable {
+            async->Post([ctx = std::move(ctx), label = std::move(label), status,
+                         pipeline = std::move(pipeline)] {
+                switch (status) {
+                    case wgpu::CreatePipelineAsyncStatus::Success:
+                        ctx->promise.Resolve(
+                            interop::GPUComputePipeline::Create<GPUComputePipeline>(
+                                ctx->env, pipeline, label));
+                        break;
+                    default:
+                        ctx->promise.Reject(Errors::GPUPipelineError(ctx->env));
+                        break;
+                }
+            });
         });
 
     return promise;
@@ -421,18 +428,24 @@ GPUDevice::createRenderPipelineAsync(Napi::Env env,
     auto promise = ctx->promise;
 
     device_.CreateRenderPipelineAsync(
-        &desc, wgpu::CallbackMode::AllowProcessEvents,
-        [ctx = std::move(ctx), label = std::string(desc.label ? desc.label : "")](
-            wgpu::CreatePipelineAsyncStatus status, wgpu::RenderPipeline pipeline, char const*) {
-            switch (status) {
-                case wgpu::CreatePipelineAsyncStatus::Success:
-                    ctx->promise.Resolve(interop::GPURenderPipeline::Create<GPURenderPipeline>(
-                        ctx->env, pipeline, label));
-                    break;
-                default:
-                    ctx->promise.Reject(Errors::GPUPipelineError(ctx->env));
-                    break;
-            }
+        &desc, wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx), async = async_.get(),
+         label = std::string(desc.label ? desc.label : "")](
+            wgpu::CreatePipelineAsyncStatus status, wgpu::RenderPipeline pipeline,
+            char const*) mutable {
+            async->Post([ctx = std::move(ctx), label = std::move(label), status,
+                         pipeline = std::move(pipeline)] {
+                switch (status) {
+                    case wgpu::CreatePipelineAsyncStatus::Success:
+                        ctx->promise.Resolve(
+                            interop::GPURenderPipeline::Create<GPURenderPipeline>(
+                                ctx->env, pipeline, label));
+                        break;
+                    default:
+                        ctx->promise.Reject(Errors::GPUPipelineError(ctx->env));
+                        break;
+                }
+            });
         });
 
     return promise;
@@ -513,44 +526,47 @@ interop::Promise<std::optional<interop::Interface<interop::GPUError>>> GPUDevice
     auto promise = ctx->promise;
 
     device_.PopErrorScope(
-        wgpu::CallbackMode::AllowProcessEvents,
-        [ctx = std::move(ctx)](wgpu::PopErrorScopeStatus, wgpu::ErrorType type,
-                               char const* message) {
-            auto env = ctx->env;
-            switch (type) {
-                case wgpu::ErrorType::NoError:
-                    ctx->promise.Resolve({});
-                    break;
-                case wgpu::ErrorType::OutOfMemory: {
-                    interop::Interface<interop::GPUError> err{
-                        interop::GPUOutOfMemoryError::Create<OOMError>(env, message)};
-                    ctx->promise.Resolve(err);
-                    break;
-                }
-                case wgpu::ErrorType::Validation: {
-                    interop::Interface<interop::GPUError> err{
-                        interop::GPUValidationError::Create<ValidationError>(env, message)};
-                    ctx->promise.Resolve(err);
-                    break;
-                }
-                case wgpu::ErrorType::Internal: {
-                    interop::Interface<interop::GPUError> err{
-                        interop::GPUInternalError::Create<InternalError>(env, message)};
-                    ctx->promise.Resolve(err);
-                    break;
+        wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx), async = async_.get()](
+            wgpu::PopErrorScopeStatus, wgpu::ErrorType type, char const* message) mutable {
+            async->Post([ctx = std::move(ctx), type,
+                         message = std::string(message ? message : "")] {
+                auto env = ctx->env;
+                switch (type) {
+                    case wgpu::ErrorType::NoError:
+                        ctx->promise.Resolve({});
+                        break;
+                    case wgpu::ErrorType::OutOfMemory: {
+                        interop::Interface<interop::GPUError> err{
+                            interop::GPUOutOfMemoryError::Create<OOMError>(env, message)};
+                        ctx->promise.Resolve(err);
+                        break;
+                    }
+                    case wgpu::ErrorType::Validation: {
+                        interop::Interface<interop::GPUError> err{
+                            interop::GPUValidationError::Create<ValidationError>(env, message)};
+                        ctx->promise.Resolve(err);
+                        break;
+                    }
+                    case wgpu::ErrorType::Internal: {
+                        interop::Interface<interop::GPUError> err{
+                            interop::GPUInternalError::Create<InternalError>(env, message)};
+                        ctx->promise.Resolve(err);
+                        break;
+                    }
+                    case wgpu::ErrorType::Unknown:
+                    case wgpu::ErrorType::DeviceLost:
+                        ctx->promise.Reject(Errors::OperationError(env, message));
+                        break;
+                    default:
+                        ctx->promise.Reject(
+                            "unhandled error type (" +
+                            std::to_string(
+                                static_cast<std::underlying_type<wgpu::ErrorType>::type>(type)) +
+                            ")");
+                        break;
                 }
-                case wgpu::ErrorType::Unknown:
-                case wgpu::ErrorType::DeviceLost:
-                    ctx->promise.Reject(Errors::OperationError(env, message));
-                    break;
-                default:
-                    ctx->promise.Reject(
-                        "unhandled error type (" +
-                        std::to_string(
-                            static_cast<std::underlying_type<wgpu::ErrorType>::type>(type)) +
-                        ")");
-                    break;
-            }
+            });
         });
 
     return promise;
@@ -63,14 +63,19 @@ interop::Promise<void> GPUQueue::onSubmittedWorkDone(Napi::Env env) {
     auto ctx = std::make_unique<AsyncContext<void>>(env, PROMISE_INFO, async_);
     auto promise = ctx->promise;
 
-    queue_.OnSubmittedWorkDone(wgpu::CallbackMode::AllowProcessEvents,
-                               [ctx = std::move(ctx)](wgpu::QueueWorkDoneStatus status) {
-                                   if (status != wgpu::QueueWorkDoneStatus::Success) {
-                                       Napi::Error::New(ctx->env, "onSubmittedWorkDone() failed")
-                                           .ThrowAsJavaScriptException();
-                                   }
-                                   ctx->promise.Resolve();
-                               });
+    auto future = queue_.OnSubmittedWorkDone(
+        wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx),
+         async = async_.get()](wgpu::QueueWorkDoneStatus status) mutable {
+            async->Post([ctx = std::move(ctx), status] {
+                if (status != wgpu::QueueWorkDoneStatus::Success) {
+                    Napi::Error::New(ctx->env, "onSubmittedWorkDone() failed")
+                        .ThrowAsJavaScriptException();
+                }
+                ctx->promise.Resolve();
+            });
+        });
+    async_->Wait(queue_, future);
 
     return promise;
 }
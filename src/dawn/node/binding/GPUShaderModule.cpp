@@ -94,18 +94,25 @@ GPUShaderModule::getCompilationInfo(Napi::Env env) {
     auto promise = ctx->promise;
 
     shader_.GetCompilationInfo(
-        wgpu::CallbackMode::AllowProcessEvents,
-        [ctx = std::move(ctx)](wgpu::CompilationInfoRequestStatus status,
-                               wgpu::CompilationInfo const* compilationInfo) {
-            Messages messages(compilationInfo->messageCount);
-            for (uint32_t i = 0; i < compilationInfo->messageCount; i++) {
-                auto& msg = compilationInfo->messages[i];
-                messages[i] =
-                    interop::GPUCompilationMessage::Create<GPUCompilationMessage>(ctx->env, msg);
-            }
-
-            ctx->promise.Resolve(interop::GPUCompilationInfo::Create<GPUCompilationInfo>(
-                ctx->env, ctx->env, std::move(messages)));
+        wgpu::CallbackMode::AllowSpontaneous,
+        [ctx = std::move(ctx), async = async_.get()](
+            wgpu::CompilationInfoRequestStatus status,
+            wgpu::CompilationInfo const* compilationInfo) mutable {
+            // The message strings are owned by the shader module, but the array is only valid for
+            // the duration of the callback.
+            std::vector<WGPUCompilationMessage> msgs(
+                compilationInfo->messages,
+                compilationInfo->messages + compilationInfo->messageCount);
+            async->Post([ctx = std::move(ctx), msgs = std::move(msgs)] {
+                Messages messages(msgs.size());
+                for (size_t i = 0; i < msgs.size(); i++) {
+                    messages[i] = interop::GPUCompilationMessage::Create<GPUCompilationMessage>(
+                        ctx->env, msgs[i]);
+                }
+
+                ctx->promise.Resolve(interop::GPUCompilationInfo::Create<GPUCompilationInfo>(
+                    ctx->env, ctx->env, std::move(messages)));
+            });
         });
 
     return promise;
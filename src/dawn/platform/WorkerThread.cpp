@@ -27,77 +27,211 @@
 
 #include "dawn/platform/WorkerThread.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <condition_variable>
-#include <functional>
+#include <deque>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "dawn/common/Assert.h"
+#include "dawn/common/RefCounted.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::platform {
 
 namespace {
 
-class AsyncWaitableEventImpl {
+// Waiting on a task uses one of a small set of mutex and condition variable pairs shared by all
+// tasks, selected from the address of the task, instead of a pair per task. Completion is an
+// atomic flag so checking it doesn't take a lock, and the pair is only used when a thread has
+// to block.
+struct WaitSlot {
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+constexpr size_t kWaitSlotCount = 16;
+
+WaitSlot& GetWaitSlot(const void* address) {
+    static std::array<WaitSlot, kWaitSlotCount> slots;
+    // Drop the low bits that are the same for all heap allocations.
+    size_t index = (reinterpret_cast<uintptr_t>(address) >> 4) % kWaitSlotCount;
+    return slots[index];
+}
+
+}  // anonymous namespace
+
+class WorkerTask final : public RefCounted {
   public:
-    AsyncWaitableEventImpl() : mIsComplete(false) {}
+    WorkerTask(PostWorkerTaskCallback callback, void* userdata)
+        : mCallback(callback), mUserdata(userdata) {}
 
-    void Wait() {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return mIsComplete; });
-    }
+    void Run() {
+        mCallback(mUserdata);
 
-    bool IsComplete() {
-        std::lock_guard<std::mutex> lock(mMutex);
-        return mIsComplete;
+        WaitSlot& slot = GetWaitSlot(this);
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            mIsComplete.store(true, std::memory_order_release);
+        }
+        slot.condition.notify_all();
     }
 
-    void MarkAsComplete() {
-        {
-            std::lock_guard<std::mutex> lock(mMutex);
-            mIsComplete = true;
+    void Wait() {
+        if (IsComplete()) {
+            return;
         }
-        mCondition.notify_all();
+        WaitSlot& slot = GetWaitSlot(this);
+        std::unique_lock<std::mutex> lock(slot.mutex);
+        slot.condition.wait(lock, [this] { return IsComplete(); });
     }
 
+    bool IsComplete() const { return mIsComplete.load(std::memory_order_acquire); }
+
   private:
-    std::mutex mMutex;
-    std::condition_variable mCondition;
-    bool mIsComplete;
+    ~WorkerTask() override = default;
+
+    PostWorkerTaskCallback mCallback;
+    raw_ptr<void> mUserdata;
+    std::atomic<bool> mIsComplete = false;
 };
 
-class AsyncWaitableEvent final : public dawn::platform::WaitableEvent {
+namespace {
+
+// The event shares ownership of the task with the pool because the event may be destroyed before
+// the task completes, or the task may complete and be dropped by the pool before the event is
+// waited on.
+class AsyncWaitableEvent final : public WaitableEvent {
+  public:
+    explicit AsyncWaitableEvent(Ref<WorkerTask> task) : mTask(std::move(task)) {}
+
+    void Wait() override { mTask->Wait(); }
+
+    bool IsComplete() override { return mTask->IsComplete(); }
+
+  private:
+    Ref<WorkerTask> mTask;
+};
+
+uint32_t GetDefaultMaxThreadCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // anonymous namespace
+
+class WorkerThreadPoolState final : public RefCounted {
   public:
-    AsyncWaitableEvent() : mWaitableEventImpl(std::make_shared<AsyncWaitableEventImpl>()) {}
+    explicit WorkerThreadPoolState(uint32_t maxThreadCount) : mMaxThreadCount(maxThreadCount) {
+        DAWN_ASSERT(mMaxThreadCount > 0);
+    }
+
+    void Post(Ref<WorkerTask> task) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        DAWN_ASSERT(!mStopping);
+        mTasks.push_back(std::move(task));
+
+        // Only spawn a new thread if the idle threads can't pick up all the queued tasks.
+        if (mTasks.size() > mIdleThreadCount && mThreads.size() < mMaxThreadCount) {
+            mThreads.emplace_back([self = Ref<WorkerThreadPoolState>(this)] { self->Loop(); });
+        }
+
+        // Notify while holding the lock: the task may destroy the pool, which must not happen
+        // before this function stops using the state.
+        mTaskAvailable.notify_one();
+    }
 
-    void Wait() override { mWaitableEventImpl->Wait(); }
+    void Stop() {
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStopping = true;
+            threads = std::move(mThreads);
+        }
+        mTaskAvailable.notify_all();
+
+        for (std::thread& thread : threads) {
+            if (thread.get_id() == std::this_thread::get_id()) {
+                // The pool is destroyed from one of its tasks. The thread keeps a reference to
+                // the state and exits after draining the queue.
+                thread.detach();
+            } else {
+                thread.join();
+            }
+        }
+    }
 
-    bool IsComplete() override { return mWaitableEventImpl->IsComplete(); }
+    uint32_t GetMaxThreadCount() const { return mMaxThreadCount; }
 
-    std::shared_ptr<AsyncWaitableEventImpl> GetWaitableEventImpl() const {
-        return mWaitableEventImpl;
+    uint32_t GetThreadCount() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return static_cast<uint32_t>(mThreads.size());
     }
 
   private:
-    std::shared_ptr<AsyncWaitableEventImpl> mWaitableEventImpl;
+    ~WorkerThreadPoolState() override { DAWN_ASSERT(mTasks.empty()); }
+
+    void Loop() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true) {
+            while (mTasks.empty() && !mStopping) {
+                mIdleThreadCount++;
+                mTaskAvailable.wait(lock);
+                mIdleThreadCount--;
+            }
+            // Queued tasks are still run when the pool is stopping since their events may be
+            // waited on.
+            if (mTasks.empty()) {
+                return;
+            }
+
+            Ref<WorkerTask> task = std::move(mTasks.front());
+            mTasks.pop_front();
+
+            lock.unlock();
+            task->Run();
+            task = nullptr;
+            lock.lock();
+        }
+    }
+
+    const uint32_t mMaxThreadCount;
+
+    std::mutex mMutex;
+    std::condition_variable mTaskAvailable;
+    std::deque<Ref<WorkerTask>> mTasks;
+    std::vector<std::thread> mThreads;
+    size_t mIdleThreadCount = 0;
+    bool mStopping = false;
 };
 
-}  // anonymous namespace
+AsyncWorkerThreadPool::AsyncWorkerThreadPool()
+    : AsyncWorkerThreadPool(GetDefaultMaxThreadCount()) {}
 
-namespace dawn::platform {
+AsyncWorkerThreadPool::AsyncWorkerThreadPool(uint32_t maxThreadCount)
+    : mState(AcquireRef(new WorkerThreadPoolState(maxThreadCount))) {}
+
+AsyncWorkerThreadPool::~AsyncWorkerThreadPool() {
+    mState->Stop();
+}
 
 std::unique_ptr<dawn::platform::WaitableEvent> AsyncWorkerThreadPool::PostWorkerTask(
     dawn::platform::PostWorkerTaskCallback callback,
     void* userdata) {
-    std::unique_ptr<AsyncWaitableEvent> waitableEvent = std::make_unique<AsyncWaitableEvent>();
-
-    std::function<void()> doTask = [callback, userdata,
-                                    waitableEventImpl = waitableEvent->GetWaitableEventImpl()] {
-        callback(userdata);
-        waitableEventImpl->MarkAsComplete();
-    };
+    Ref<WorkerTask> task = AcquireRef(new WorkerTask(callback, userdata));
+    auto waitableEvent = std::make_unique<AsyncWaitableEvent>(task);
+    mState->Post(std::move(task));
+    return waitableEvent;
+}
 
-    std::thread thread(doTask);
-    thread.detach();
+uint32_t AsyncWorkerThreadPool::GetMaxThreadCountForTesting() const {
+    return mState->GetMaxThreadCount();
+}
 
-    return waitableEvent;
+uint32_t AsyncWorkerThreadPool::GetThreadCountForTesting() const {
+    return mState->GetThreadCount();
 }
 
 }  // namespace dawn::platform
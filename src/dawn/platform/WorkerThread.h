@@ -31,15 +31,35 @@
 #include <memory>
 
 #include "dawn/common/NonCopyable.h"
+#include "dawn/common/Ref.h"
 #include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::platform {
 
+class WorkerThreadPoolState;
+
+// A pool of worker threads that runs the posted tasks in FIFO order. Threads are spawned lazily,
+// when a task is posted and no worker is idle, up to the number of hardware threads so that
+// posting many tasks at once (for example when creating hundreds of pipelines asynchronously)
+// doesn't oversubscribe the CPU. Tasks must not block waiting on tasks posted after them.
 class AsyncWorkerThreadPool : public dawn::platform::WorkerTaskPool, public NonCopyable {
   public:
+    AsyncWorkerThreadPool();
+    explicit AsyncWorkerThreadPool(uint32_t maxThreadCount);
+    // Runs the tasks that are still queued, then joins the worker threads.
+    ~AsyncWorkerThreadPool() override;
+
     std::unique_ptr<dawn::platform::WaitableEvent> PostWorkerTask(
         dawn::platform::PostWorkerTaskCallback callback,
         void* userdata) override;
+
+    uint32_t GetMaxThreadCountForTesting() const;
+    uint32_t GetThreadCountForTesting() const;
+
+  private:
+    // The state is shared with the worker threads so that the pool can be destroyed from one of
+    // its own tasks, for example when a task drops the last reference to the device.
+    Ref<WorkerThreadPoolState> mState;
 };
 
 }  // namespace dawn::platform
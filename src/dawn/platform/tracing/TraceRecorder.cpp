@@ -0,0 +1,272 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/platform/tracing/TraceRecorder.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <utility>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Log.h"
+#include "dawn/common/SystemUtils.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::platform::tracing {
+
+namespace {
+
+std::atomic<uint64_t> gNextRecorderId = 1;
+
+TraceRecorder* gProcessRecorder = nullptr;
+
+void WriteProcessRecorderFile() {
+    gProcessRecorder->WriteJSONFile();
+}
+
+// The trace event macros cache the category flags in static variables of each call site, so the
+// flags must outlive all the recorders.
+constexpr unsigned char kCategoryEnabled[] = {1, 1, 1, 1};
+
+static_assert(static_cast<uint32_t>(TraceCategory::General) == 0);
+static_assert(static_cast<uint32_t>(TraceCategory::Validation) == 1);
+static_assert(static_cast<uint32_t>(TraceCategory::Recording) == 2);
+static_assert(static_cast<uint32_t>(TraceCategory::GPUWork) == 3);
+
+const char* CategoryName(TraceCategory category) {
+    switch (category) {
+        case TraceCategory::General:
+            return "general";
+        case TraceCategory::Validation:
+            return "validation";
+        case TraceCategory::Recording:
+            return "recording";
+        case TraceCategory::GPUWork:
+            return "gpu";
+    }
+    DAWN_UNREACHABLE();
+}
+
+void WriteJSONString(std::ostream& stream, const char* string) {
+    stream << '"';
+    for (const char* c = string; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') {
+            stream << '\\';
+        }
+        stream << *c;
+    }
+    stream << '"';
+}
+
+void WriteJSONArgValue(std::ostream& stream, unsigned char type, uint64_t value) {
+    switch (type) {
+        case TRACE_VALUE_TYPE_BOOL:
+            stream << (value != 0 ? "true" : "false");
+            break;
+        case TRACE_VALUE_TYPE_INT:
+            stream << static_cast<int64_t>(value);
+            break;
+        case TRACE_VALUE_TYPE_DOUBLE: {
+            double doubleValue;
+            static_assert(sizeof(doubleValue) == sizeof(value));
+            memcpy(&doubleValue, &value, sizeof(value));
+            stream << doubleValue;
+            break;
+        }
+        case TRACE_VALUE_TYPE_POINTER:
+            stream << "\"0x" << std::hex << value << std::dec << '"';
+            break;
+        default:
+            stream << value;
+            break;
+    }
+}
+
+}  // anonymous namespace
+
+TraceRecorder::ThreadBuffer::ThreadBuffer(uint32_t threadIndex)
+    : threadIndex(threadIndex), events(kEventsPerThread) {}
+
+TraceRecorder::TraceRecorder(std::string outputPath)
+    : mOutputPath(std::move(outputPath)),
+      mRecorderId(gNextRecorderId++),
+      mOrigin(std::chrono::steady_clock::now()) {}
+
+TraceRecorder::~TraceRecorder() {
+    if (!mOutputPath.empty()) {
+        WriteJSONFile();
+    }
+}
+
+// static
+TraceRecorder* TraceRecorder::GetForProcess() {
+    static TraceRecorder* recorder = []() -> TraceRecorder* {
+        auto [path, present] = GetEnvironmentVar(kTraceFileEnvironmentVariable);
+        if (!present || path.empty()) {
+            return nullptr;
+        }
+        // Leaked on purpose, as instances and the static objects of other libraries may still
+        // record events while the process exits. The file is written at exit instead of by the
+        // destructor.
+        gProcessRecorder = new TraceRecorder(std::move(path));
+        std::atexit(WriteProcessRecorderFile);
+        return gProcessRecorder;
+    }();
+    return recorder;
+}
+
+const unsigned char* TraceRecorder::GetTraceCategoryEnabledFlag(TraceCategory category) {
+    size_t index = static_cast<size_t>(category);
+    DAWN_ASSERT(index < std::size(kCategoryEnabled));
+    return &kCategoryEnabled[index];
+}
+
+double TraceRecorder::MonotonicallyIncreasingTime() {
+    // steady_clock is a vDSO call on the common platforms, so it doesn't enter the kernel. Use
+    // the creation of the recorder as the origin to keep the timestamps small.
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - mOrigin).count();
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer() {
+    struct CachedThreadBuffer {
+        uint64_t recorderId = 0;
+        ThreadBuffer* buffer = nullptr;
+    };
+    thread_local CachedThreadBuffer cache;
+
+    if (cache.recorderId != mRecorderId) {
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        std::unique_ptr<ThreadBuffer>& buffer = mThreadBuffers[std::this_thread::get_id()];
+        if (buffer == nullptr) {
+            buffer = std::make_unique<ThreadBuffer>(static_cast<uint32_t>(mThreadBuffers.size()));
+        }
+        cache = {mRecorderId, buffer.get()};
+    }
+    return cache.buffer;
+}
+
+uint64_t TraceRecorder::AddTraceEvent(char phase,
+                                      const unsigned char* categoryGroupEnabled,
+                                      const char* name,
+                                      uint64_t id,
+                                      double timestamp,
+                                      int numArgs,
+                                      const char** argNames,
+                                      const unsigned char* argTypes,
+                                      const uint64_t* argValues,
+                                      unsigned char flags) {
+    // The flag may come from another platform that was used first at the call site.
+    uint8_t category = static_cast<uint8_t>(TraceCategory::General);
+    if (categoryGroupEnabled >= std::begin(kCategoryEnabled) &&
+        categoryGroupEnabled < std::end(kCategoryEnabled)) {
+        category = static_cast<uint8_t>(categoryGroupEnabled - std::begin(kCategoryEnabled));
+    }
+
+    ThreadBuffer* buffer = GetThreadBuffer();
+    uint64_t eventIndex = buffer->eventCount.load(std::memory_order_relaxed);
+
+    Event& event = buffer->events[eventIndex % kEventsPerThread];
+    event.phase = phase;
+    event.flags = flags;
+    event.category = category;
+    event.name = name;
+    event.id = id;
+    event.timestamp = timestamp;
+    event.numArgs = 0;
+    for (int i = 0; i < numArgs && event.numArgs < kMaxArgs; ++i) {
+        if (argTypes[i] == TRACE_VALUE_TYPE_STRING ||
+            argTypes[i] == TRACE_VALUE_TYPE_COPY_STRING) {
+            continue;
+        }
+        event.argNames[event.numArgs] = argNames[i];
+        event.argTypes[event.numArgs] = argTypes[i];
+        event.argValues[event.numArgs] = argValues[i];
+        event.numArgs++;
+    }
+
+    buffer->eventCount.store(eventIndex + 1, std::memory_order_release);
+    return 0;
+}
+
+void TraceRecorder::WriteJSON(std::ostream& stream) const {
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+
+    // Timestamps are in microseconds, keep nanosecond precision.
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& [threadId, buffer] : mThreadBuffers) {
+        uint64_t eventCount = buffer->eventCount.load(std::memory_order_acquire);
+        uint64_t firstEvent = eventCount - std::min<uint64_t>(eventCount, kEventsPerThread);
+
+        for (uint64_t i = firstEvent; i < eventCount; ++i) {
+            const Event& event = buffer->events[i % kEventsPerThread];
+
+            stream << (first ? "\n" : ",\n");
+            first = false;
+
+            stream << "{\"name\":";
+            WriteJSONString(stream, event.name);
+            stream << ",\"cat\":\"" << CategoryName(static_cast<TraceCategory>(event.category))
+                   << "\",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":"
+                   << buffer->threadIndex << ",\"ts\":" << event.timestamp * 1000.0 * 1000.0;
+            if (event.flags & TRACE_EVENT_FLAG_HAS_ID) {
+                stream << ",\"id\":\"0x" << std::hex << event.id << std::dec << '"';
+            }
+            if (event.numArgs > 0) {
+                stream << ",\"args\":{";
+                for (uint8_t arg = 0; arg < event.numArgs; ++arg) {
+                    if (arg > 0) {
+                        stream << ',';
+                    }
+                    WriteJSONString(stream, event.argNames[arg]);
+                    stream << ':';
+                    WriteJSONArgValue(stream, event.argTypes[arg], event.argValues[arg]);
+                }
+                stream << '}';
+            }
+            stream << '}';
+        }
+    }
+    stream << "\n]}\n";
+}
+
+bool TraceRecorder::WriteJSONFile() const {
+    std::ofstream file(mOutputPath, std::ios_base::out | std::ios_base::trunc);
+    if (!file) {
+        dawn::WarningLog() << "Failed to open the trace file " << mOutputPath;
+        return false;
+    }
+    WriteJSON(file);
+    return true;
+}
+
+}  // namespace dawn::platform::tracing
@@ -0,0 +1,131 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_PLATFORM_TRACING_TRACERECORDER_H_
+#define SRC_DAWN_PLATFORM_TRACING_TRACERECORDER_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/dawn_platform_export.h"
+
+namespace dawn::platform::tracing {
+
+// A Platform that records the trace events of Dawn in memory and writes them in the Chrome trace
+// event JSON format, which can be loaded in chrome://tracing or the Perfetto UI. When the
+// DAWN_TRACE_FILE environment variable is set, a process-wide TraceRecorder is the default platform
+// of all the instances, so that Dawn can be profiled without an embedder implementing tracing.
+// Recording is process-wide because the trace event macros cache the category flags of the first
+// platform used at each call site.
+//
+// Each thread records events in its own fixed-size ring buffer without taking any lock. When a
+// buffer is full, its oldest events are overwritten. Events must not be recorded concurrently
+// with WriteJSON.
+class DAWN_PLATFORM_EXPORT TraceRecorder final : public Platform {
+  public:
+    static constexpr char kTraceFileEnvironmentVariable[] = "DAWN_TRACE_FILE";
+    static constexpr size_t kEventsPerThread = 1 << 14;
+
+    // The events are written to `outputPath` when the TraceRecorder is destroyed, unless it is
+    // empty.
+    explicit TraceRecorder(std::string outputPath);
+    ~TraceRecorder() override;
+
+    // Returns the process-wide TraceRecorder if DAWN_TRACE_FILE is set, or nullptr. It is created
+    // on first use, is never destroyed, and writes its events to the path in DAWN_TRACE_FILE when
+    // the process exits.
+    static TraceRecorder* GetForProcess();
+
+    // Writes the recorded events, or only the last kEventsPerThread events of each thread if more
+    // were recorded.
+    void WriteJSON(std::ostream& stream) const;
+    bool WriteJSONFile() const;
+
+    const unsigned char* GetTraceCategoryEnabledFlag(TraceCategory category) override;
+    double MonotonicallyIncreasingTime() override;
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override;
+
+  private:
+    static constexpr int kMaxArgs = 2;
+
+    struct Event {
+        char phase;
+        unsigned char flags;
+        uint8_t category;
+        uint8_t numArgs;
+        const char* name;
+        uint64_t id;
+        double timestamp;
+        // Only the arguments with numeric values are kept, as the strings of the others may not
+        // outlive the event.
+        std::array<const char*, kMaxArgs> argNames;
+        std::array<unsigned char, kMaxArgs> argTypes;
+        std::array<uint64_t, kMaxArgs> argValues;
+    };
+
+    struct ThreadBuffer {
+        explicit ThreadBuffer(uint32_t threadIndex);
+
+        const uint32_t threadIndex;
+        // Only incremented by the thread owning the buffer, after the event is written.
+        std::atomic<uint64_t> eventCount = 0;
+        std::vector<Event> events;
+    };
+
+    ThreadBuffer* GetThreadBuffer();
+
+    const std::string mOutputPath;
+    // Used to find the buffer of the current thread in its thread_local cache.
+    const uint64_t mRecorderId;
+    const std::chrono::steady_clock::time_point mOrigin;
+
+    mutable std::mutex mThreadBuffersMutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+};
+
+}  // namespace dawn::platform::tracing
+
+#endif  // SRC_DAWN_PLATFORM_TRACING_TRACERECORDER_H_
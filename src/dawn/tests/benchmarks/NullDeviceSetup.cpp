@@ -50,6 +50,7 @@ void NullDeviceBenchmarkFixture::SetUp(const benchmark::State& state) {
         // Only thread 0 is responsible for initializing the device on each iteration.
         {
             std::lock_guard<std::mutex> lock(mMutex);
+            instance = wgpu::Instance(nativeInstance->Get());
 
             // Get an adapter to create the device with.
             wgpu::RequestAdapterOptions options = {};
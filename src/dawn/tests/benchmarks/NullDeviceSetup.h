@@ -45,6 +45,7 @@ class NullDeviceBenchmarkFixture : public benchmark::Fixture {
     void TearDown(const benchmark::State& state) override;
 
   protected:
+    wgpu::Instance instance = nullptr;
     wgpu::Adapter adapter = nullptr;
     wgpu::Device device = nullptr;
 
@@ -0,0 +1,113 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "dawn/common/ContentLessObjectCache.h"
+#include "dawn/common/Ref.h"
+#include "dawn/common/RefCounted.h"
+
+namespace dawn {
+namespace {
+
+// Benchmarks for the frontend object cache in isolation from the rest of object creation, so that
+// its scaling across threads isn't hidden by the device lock.
+class CachedObject : public RefCounted, public ContentLessObjectCacheable<CachedObject> {
+  public:
+    explicit CachedObject(size_t value) : mValue(value) {}
+    ~CachedObject() override { Uncache(); }
+
+    struct HashFunc {
+        size_t operator()(const CachedObject* x) const { return x->mValue; }
+    };
+    struct EqualityFunc {
+        bool operator()(const CachedObject* l, const CachedObject* r) const {
+            return l->mValue == r->mValue;
+        }
+    };
+
+  private:
+    size_t mValue;
+};
+
+constexpr size_t kNumCachedObjects = 1024;
+
+// Looks up objects that are already in the cache, which is the common case when deduplicating
+// samplers, layouts and pipelines.
+void ObjectCacheFindHit(benchmark::State& state) {
+    static ContentLessObjectCache<CachedObject>* cache = nullptr;
+    static std::vector<Ref<CachedObject>>* objects = nullptr;
+    if (state.thread_index() == 0) {
+        cache = new ContentLessObjectCache<CachedObject>();
+        objects = new std::vector<Ref<CachedObject>>();
+        for (size_t i = 0; i < kNumCachedObjects; ++i) {
+            Ref<CachedObject> object = AcquireRef(new CachedObject(i));
+            cache->Insert(object.Get());
+            objects->push_back(std::move(object));
+        }
+    }
+
+    size_t i = state.thread_index();
+    for (auto _ : state) {
+        CachedObject blueprint(i++ % kNumCachedObjects);
+        benchmark::DoNotOptimize(cache->Find(&blueprint));
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        delete objects;
+        delete cache;
+    }
+}
+BENCHMARK(ObjectCacheFindHit)->ThreadRange(1, 16)->UseRealTime();
+
+// Inserts objects that are unique to each thread and releases them right away, which exercises the
+// exclusive Insert and Erase paths.
+void ObjectCacheInsertUnique(benchmark::State& state) {
+    static ContentLessObjectCache<CachedObject>* cache = nullptr;
+    if (state.thread_index() == 0) {
+        cache = new ContentLessObjectCache<CachedObject>();
+    }
+
+    size_t i = state.thread_index();
+    for (auto _ : state) {
+        Ref<CachedObject> object = AcquireRef(new CachedObject(i));
+        benchmark::DoNotOptimize(cache->Insert(object.Get()));
+        i += state.threads();
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        delete cache;
+    }
+}
+BENCHMARK(ObjectCacheInsertUnique)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
+}  // namespace dawn
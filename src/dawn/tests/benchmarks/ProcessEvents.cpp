@@ -0,0 +1,73 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu_cpp.h>
+#include <vector>
+
+#include "dawn/common/Assert.h"
+#include "dawn/tests/benchmarks/NullDeviceSetup.h"
+
+namespace dawn {
+namespace {
+
+// Benchmarks for the completion of futures by ProcessEvents.
+class ProcessEvents : public NullDeviceBenchmarkFixture {
+  private:
+    wgpu::DeviceDescriptor GetDeviceDescriptor() const override { return {}; }
+};
+
+// Completes one future per ProcessEvents while state.range(0) other futures are outstanding. The
+// outstanding futures are WaitAnyOnly so ProcessEvents never completes them, and it should only
+// pay for the future that completed.
+BENCHMARK_DEFINE_F(ProcessEvents, OutstandingFutures)
+(benchmark::State& state) {
+    wgpu::Queue queue = device.GetQueue();
+
+    std::vector<wgpu::FutureWaitInfo> outstanding(state.range(0));
+    for (wgpu::FutureWaitInfo& info : outstanding) {
+        info.future = queue.OnSubmittedWorkDone(wgpu::CallbackMode::WaitAnyOnly,
+                                                [](wgpu::QueueWorkDoneStatus) {});
+    }
+
+    for (auto _ : state) {
+        bool done = false;
+        queue.OnSubmittedWorkDone(wgpu::CallbackMode::AllowProcessEvents,
+                                  [&done](wgpu::QueueWorkDoneStatus) { done = true; });
+        instance.ProcessEvents();
+        DAWN_ASSERT(done);
+    }
+
+    // Complete the outstanding futures so that they don't keep the device alive.
+    if (!outstanding.empty()) {
+        instance.WaitAny(outstanding.size(), outstanding.data(), 0);
+    }
+}
+BENCHMARK_REGISTER_F(ProcessEvents, OutstandingFutures)->Arg(0)->Arg(100)->Arg(10000);
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -0,0 +1,332 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <dawn/webgpu.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include "dawn/dawn_proc_table.h"
+#include "dawn/native/DawnNative.h"
+#include "dawn/utils/SharedMemoryRing.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn {
+namespace {
+
+constexpr size_t kClientToServerRingSize = 4 * 1024 * 1024;
+constexpr size_t kServerToClientRingSize = 1024 * 1024;
+constexpr uint64_t kServerIdleTimeoutNs = 100'000'000;
+constexpr uint64_t kInfiniteTimeoutNs = std::numeric_limits<uint64_t>::max();
+
+// Runs a wire server on a Null device until the client closes its ring. This is the body of the
+// server process and never returns.
+[[noreturn]] void RunServer(utils::SharedMemoryRing* c2sRing,
+                            utils::SharedMemoryRing* s2cRing,
+                            const wire::Handle& instanceHandle) {
+    const DawnProcTable& procs = native::GetProcs();
+    auto nativeInstance = std::make_unique<native::Instance>();
+
+    utils::SharedMemoryRingSerializer serializer(s2cRing);
+    wire::WireServerDescriptor serverDesc = {};
+    serverDesc.procs = &procs;
+    serverDesc.serializer = &serializer;
+    wire::WireServer server(serverDesc);
+    server.InjectInstance(nativeInstance->Get(), instanceHandle);
+
+    utils::SharedMemoryRingReceiver receiver(c2sRing);
+    bool needsTick = false;
+    while (!c2sRing->IsClosed()) {
+        receiver.WaitForCommands(needsTick ? 0 : kServerIdleTimeoutNs);
+        if (!receiver.ProcessCommands(&server)) {
+            break;
+        }
+        needsTick = native::InstanceProcessEvents(nativeInstance->Get());
+        serializer.Flush();
+    }
+
+    // Exit without running destructors, the objects are also owned by the client process.
+    s2cRing->Close();
+    _exit(0);
+}
+
+// Benchmarks for a wire client talking to a wire server in another process through
+// SharedMemoryRings. The server uses the Null backend so that the transport and the wire are the
+// bottleneck.
+class WireSharedMemory : public benchmark::Fixture {
+  public:
+    void SetUp(const benchmark::State&) override {
+        mC2sRing = utils::SharedMemoryRing::Create(kClientToServerRingSize);
+        mS2cRing = utils::SharedMemoryRing::Create(kServerToClientRingSize);
+        if (mC2sRing == nullptr || mS2cRing == nullptr) {
+            mSetUpError = "Failed to create the shared memory rings";
+            return;
+        }
+
+        mSerializer = std::make_unique<utils::SharedMemoryRingSerializer>(mC2sRing.get());
+        mReceiver = std::make_unique<utils::SharedMemoryRingReceiver>(mS2cRing.get());
+
+        wire::WireClientDescriptor clientDesc = {};
+        clientDesc.serializer = mSerializer.get();
+        mWireClient = std::make_unique<wire::WireClient>(clientDesc);
+
+        // Reserve the instance before forking so that the server process knows its handle.
+        wire::ReservedInstance reservation = mWireClient->ReserveInstance();
+        mInstance = reservation.instance;
+
+        mServerPid = fork();
+        if (mServerPid < 0) {
+            mSetUpError = "Failed to fork the wire server process";
+            return;
+        }
+        if (mServerPid == 0) {
+            RunServer(mC2sRing.get(), mS2cRing.get(), reservation.handle);
+        }
+
+        // The server may exit without closing its ring, for example if it crashes. Close both
+        // rings when it exits so that the client doesn't wait for it forever, whether it waits
+        // for replies or for space to write commands.
+        mServerWatcher = std::thread([this] {
+            int status;
+            waitpid(mServerPid, &status, 0);
+            mC2sRing->Close();
+            mS2cRing->Close();
+        });
+
+        WGPURequestAdapterOptions adapterOptions = {};
+        adapterOptions.backendType = WGPUBackendType_Null;
+        Request<WGPUAdapter> adapter;
+        mProcs.instanceRequestAdapter2(
+            mInstance, &adapterOptions,
+            {nullptr, WGPUCallbackMode_AllowSpontaneous,
+             [](WGPURequestAdapterStatus status, WGPUAdapter result, const char*, void* userdata,
+                void*) {
+                 static_cast<Request<WGPUAdapter>*>(userdata)->Complete(
+                     status == WGPURequestAdapterStatus_Success, result);
+             },
+             &adapter, nullptr});
+        if (!WaitForServer([&] { return adapter.done; })) {
+            mSetUpError = "The wire server stopped while requesting the adapter";
+            return;
+        }
+        if (adapter.result == nullptr) {
+            mSetUpError = "Failed to request the Null adapter";
+            return;
+        }
+
+        Request<WGPUDevice> device;
+        mProcs.adapterRequestDevice2(
+            adapter.result, nullptr,
+            {nullptr, WGPUCallbackMode_AllowSpontaneous,
+             [](WGPURequestDeviceStatus status, WGPUDevice result, const char*, void* userdata,
+                void*) {
+                 static_cast<Request<WGPUDevice>*>(userdata)->Complete(
+                     status == WGPURequestDeviceStatus_Success, result);
+             },
+             &device, nullptr});
+        bool serverAlive = WaitForServer([&] { return device.done; });
+        mProcs.adapterRelease(adapter.result);
+        if (!serverAlive) {
+            mSetUpError = "The wire server stopped while requesting the device";
+            return;
+        }
+        if (device.result == nullptr) {
+            mSetUpError = "Failed to request the Null device";
+            return;
+        }
+        mDevice = device.result;
+
+        mQueue = mProcs.deviceGetQueue(mDevice);
+
+        WGPUBufferDescriptor bufferDesc = {};
+        bufferDesc.size = kWriteSize;
+        bufferDesc.usage = WGPUBufferUsage_CopyDst;
+        mBuffer = mProcs.deviceCreateBuffer(mDevice, &bufferDesc);
+    }
+
+    void TearDown(const benchmark::State&) override {
+        if (mServerPid > 0) {
+            if (mBuffer != nullptr) {
+                mProcs.bufferRelease(mBuffer);
+                mBuffer = nullptr;
+            }
+            if (mQueue != nullptr) {
+                mProcs.queueRelease(mQueue);
+                mQueue = nullptr;
+            }
+            if (mDevice != nullptr) {
+                mProcs.deviceRelease(mDevice);
+                mDevice = nullptr;
+            }
+            mProcs.instanceRelease(mInstance);
+            mSerializer->Flush();
+
+            mC2sRing->Close();
+            mServerWatcher.join();
+        }
+        mServerPid = -1;
+        mSetUpError = nullptr;
+
+        mWireClient = nullptr;
+        mReceiver = nullptr;
+        mSerializer = nullptr;
+        mS2cRing = nullptr;
+        mC2sRing = nullptr;
+    }
+
+  protected:
+    static constexpr size_t kWriteSize = 64;
+
+    // Returns false and skips the benchmark if SetUp failed.
+    bool CheckSetUp(benchmark::State& state) {
+        if (mSetUpError != nullptr) {
+            state.SkipWithError(mSetUpError);
+            return false;
+        }
+        return true;
+    }
+
+    // Returns false if the server closed its ring.
+    bool FlushClient() { return mSerializer->Flush(); }
+
+    // Flushes the client commands and handles the server's replies until |isDone| returns true.
+    // Returns false if the server stopped or sent invalid commands.
+    template <typename IsDone>
+    bool WaitForServer(IsDone isDone) {
+        if (!mSerializer->Flush()) {
+            return false;
+        }
+        while (!isDone()) {
+            mReceiver->WaitForCommands(kInfiniteTimeoutNs);
+            if (!mReceiver->ProcessCommands(mWireClient.get())) {
+                return false;
+            }
+            if (!isDone() && mS2cRing->IsClosed()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Does a round-trip to the server, which also waits for all the previous commands to be
+    // handled. Skips the benchmark with an error and returns false if the server stopped.
+    bool RoundTrip(benchmark::State& state) {
+        bool done = false;
+        mProcs.queueOnSubmittedWorkDone2(
+            mQueue, {nullptr, WGPUCallbackMode_AllowSpontaneous,
+                     [](WGPUQueueWorkDoneStatus, void* userdata, void*) {
+                         *static_cast<bool*>(userdata) = true;
+                     },
+                     &done, nullptr});
+        if (!WaitForServer([&] { return done; })) {
+            state.SkipWithError("The wire server stopped");
+            return false;
+        }
+        return true;
+    }
+
+    const DawnProcTable& mProcs = wire::client::GetProcs();
+    WGPUQueue mQueue = nullptr;
+    WGPUBuffer mBuffer = nullptr;
+
+  private:
+    // The result of an adapter or device request.
+    template <typename T>
+    struct Request {
+        void Complete(bool success, T object) {
+            done = true;
+            result = success ? object : nullptr;
+        }
+
+        bool done = false;
+        T result = nullptr;
+    };
+
+    std::unique_ptr<utils::SharedMemoryRing> mC2sRing;
+    std::unique_ptr<utils::SharedMemoryRing> mS2cRing;
+    std::unique_ptr<utils::SharedMemoryRingSerializer> mSerializer;
+    std::unique_ptr<utils::SharedMemoryRingReceiver> mReceiver;
+    std::unique_ptr<wire::WireClient> mWireClient;
+    pid_t mServerPid = -1;
+    std::thread mServerWatcher;
+    const char* mSetUpError = nullptr;
+
+    WGPUInstance mInstance = nullptr;
+    WGPUDevice mDevice = nullptr;
+};
+
+// Measures how many small commands per second go through the wire when the client flushes after
+// every state.range(0) commands.
+BENCHMARK_DEFINE_F(WireSharedMemory, WriteBufferThroughput)
+(benchmark::State& state) {
+    if (!CheckSetUp(state)) {
+        return;
+    }
+    std::array<uint8_t, kWriteSize> data = {};
+    const int64_t commandsPerFlush = state.range(0);
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < commandsPerFlush; ++i) {
+            mProcs.queueWriteBuffer(mQueue, mBuffer, 0, data.data(), data.size());
+        }
+        if (!FlushClient()) {
+            state.SkipWithError("The wire server stopped");
+            return;
+        }
+    }
+    // The client ring applies backpressure so, past the first few megabytes of commands, this
+    // measures the throughput of the server side. Wait for it before the next run.
+    if (!RoundTrip(state)) {
+        return;
+    }
+
+    state.SetItemsProcessed(state.iterations() * commandsPerFlush);
+}
+BENCHMARK_REGISTER_F(WireSharedMemory, WriteBufferThroughput)->Arg(1)->Arg(16)->Arg(256);
+
+// Measures the latency of a command that the server answers.
+BENCHMARK_DEFINE_F(WireSharedMemory, RoundTripLatency)
+(benchmark::State& state) {
+    if (!CheckSetUp(state)) {
+        return;
+    }
+    for (auto _ : state) {
+        if (!RoundTrip(state)) {
+            return;
+        }
+    }
+}
+BENCHMARK_REGISTER_F(WireSharedMemory, RoundTripLatency)->UseRealTime();
+
+}  // anonymous namespace
+}  // namespace dawn
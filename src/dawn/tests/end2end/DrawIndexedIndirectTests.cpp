@@ -768,6 +768,99 @@ TEST_P(DrawIndexedIndirectTest, ValidateReusedBundleWithChangingParams) {
     EXPECT_PIXEL_RGBA8_EQ(filled, renderPass.color, 3, 1);
 }
 
+// Test that draws using the same indirect parameters in several render passes of a command encoder
+// are drawn correctly when the validated parameters are reused across the passes.
+TEST_P(DrawIndexedIndirectTest, ValidateSameParamsInMultiplePasses) {
+    // TODO(crbug.com/dawn/789): Test is failing under SwANGLE on Windows only.
+    DAWN_SUPPRESS_TEST_IF(IsANGLE() && IsWindows());
+
+    // TODO(crbug.com/dawn/1292): Some Intel OpenGL drivers don't seem to like
+    // the offsets that Tint/GLSL produces.
+    DAWN_SUPPRESS_TEST_IF(IsIntel() && IsOpenGL() && IsLinux());
+
+    // It doesn't make sense to test invalid inputs when validation is disabled.
+    DAWN_SUPPRESS_TEST_IF(HasToggleEnabled("skip_validation"));
+
+    utils::RGBA8 filled(0, 255, 0, 255);
+    utils::RGBA8 notFilled(0, 0, 0, 0);
+
+    wgpu::Buffer indirectBuffer =
+        CreateIndirectBuffer({3, 1, 0, 0, 0, 10, 1, 0, 0, 0, 3, 1, 3, 0, 0});
+    wgpu::Buffer indexBuffer = CreateIndexBuffer({0, 1, 2, 0, 3, 1});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    auto encodeRenderPass = [&](wgpu::LoadOp colorLoadOp,
+                                std::initializer_list<uint64_t> indirectOffsets) {
+        renderPass.renderPassInfo.cColorAttachments[0].loadOp = colorLoadOp;
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        pass.SetVertexBuffer(0, vertexBuffer);
+        pass.SetIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32, 0);
+        for (uint64_t indirectOffset : indirectOffsets) {
+            pass.DrawIndexedIndirect(indirectBuffer, indirectOffset);
+        }
+        pass.End();
+    };
+
+    // The invalid draw at offset 20 must stay invalid when it is reused by later passes.
+    encodeRenderPass(wgpu::LoadOp::Clear, {20});
+    encodeRenderPass(wgpu::LoadOp::Load, {20, 20});
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    TestDraw(commands, notFilled, notFilled);
+
+    // Draws with params validated by previous passes are mixed with new ones.
+    encoder = device.CreateCommandEncoder();
+    encodeRenderPass(wgpu::LoadOp::Clear, {0, 20});
+    encodeRenderPass(wgpu::LoadOp::Clear, {20, 0, 0});
+    encodeRenderPass(wgpu::LoadOp::Load, {20, 40, 0});
+
+    commands = encoder.Finish();
+    TestDraw(commands, filled, filled);
+}
+
+// Test that indirect parameters written between the render passes of a command encoder are
+// validated again rather than reusing the validation results of the previous passes.
+TEST_P(DrawIndexedIndirectTest, ValidateParamsWrittenBetweenPasses) {
+    // TODO(crbug.com/dawn/789): Test is failing under SwANGLE on Windows only.
+    DAWN_SUPPRESS_TEST_IF(IsANGLE() && IsWindows());
+
+    // TODO(crbug.com/dawn/1292): Some Intel OpenGL drivers don't seem to like
+    // the offsets that Tint/GLSL produces.
+    DAWN_SUPPRESS_TEST_IF(IsIntel() && IsOpenGL() && IsLinux());
+
+    // It doesn't make sense to test invalid inputs when validation is disabled.
+    DAWN_SUPPRESS_TEST_IF(HasToggleEnabled("skip_validation"));
+
+    utils::RGBA8 filled(0, 255, 0, 255);
+    utils::RGBA8 notFilled(0, 0, 0, 0);
+
+    wgpu::Buffer indirectBuffer = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::Indirect | wgpu::BufferUsage::CopyDst, {10, 1, 0, 0, 0});
+    wgpu::Buffer validParams = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::CopySrc, {3, 1, 0, 0, 0});
+    wgpu::Buffer indexBuffer = CreateIndexBuffer({0, 1, 2, 0, 3, 1});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    auto encodeRenderPass = [&](wgpu::LoadOp colorLoadOp) {
+        renderPass.renderPassInfo.cColorAttachments[0].loadOp = colorLoadOp;
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        pass.SetVertexBuffer(0, vertexBuffer);
+        pass.SetIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32, 0);
+        pass.DrawIndexedIndirect(indirectBuffer, 0);
+        pass.End();
+    };
+
+    // The first draw is invalid. The second one reads the valid params copied over it.
+    encodeRenderPass(wgpu::LoadOp::Clear);
+    encoder.CopyBufferToBuffer(validParams, 0, indirectBuffer, 0, 5 * sizeof(uint32_t));
+    encodeRenderPass(wgpu::LoadOp::Load);
+
+    wgpu::CommandBuffer commands = encoder.Finish();
+    TestDraw(commands, filled, notFilled);
+}
+
 DAWN_INSTANTIATE_TEST(DrawIndexedIndirectTest,
                       D3D11Backend(),
                       D3D12Backend(),
@@ -632,6 +632,44 @@ TEST_P(FutureTests, MixedSourcePolling) {
     instance.ProcessEvents();
 }
 
+// Test that ProcessEvents completes its futures in order when WaitAnyOnly futures are interleaved
+// with them, and that it leaves the WaitAnyOnly futures to WaitAny.
+TEST_P(FutureTests, ProcessEventsWithOutstandingWaitAnyOnlyFutures) {
+    constexpr uint32_t kNumFutures = 10;
+    wgpu::Queue queue = device.GetQueue();
+
+    std::vector<uint32_t> completionOrder;
+    uint32_t waitAnyOnlyCompletedCount = 0;
+    std::vector<wgpu::FutureWaitInfo> waitAnyOnlyFutures;
+    for (uint32_t i = 0; i < kNumFutures; ++i) {
+        queue.OnSubmittedWorkDone(wgpu::CallbackMode::AllowProcessEvents,
+                                  [&completionOrder, i](wgpu::QueueWorkDoneStatus status) {
+                                      ASSERT_EQ(status, wgpu::QueueWorkDoneStatus::Success);
+                                      completionOrder.push_back(i);
+                                  });
+        waitAnyOnlyFutures.push_back({queue.OnSubmittedWorkDone(
+            wgpu::CallbackMode::WaitAnyOnly,
+            [&waitAnyOnlyCompletedCount](wgpu::QueueWorkDoneStatus status) {
+                ASSERT_EQ(status, wgpu::QueueWorkDoneStatus::Success);
+                waitAnyOnlyCompletedCount++;
+            })});
+    }
+
+    while (completionOrder.size() < kNumFutures) {
+        WaitABit();
+    }
+    for (uint32_t i = 0; i < kNumFutures; ++i) {
+        EXPECT_EQ(completionOrder[i], i);
+    }
+    EXPECT_EQ(waitAnyOnlyCompletedCount, 0u);
+
+    for (wgpu::FutureWaitInfo& waitInfo : waitAnyOnlyFutures) {
+        GetInstance().WaitAny(1, &waitInfo, UINT64_MAX);
+        ASSERT_TRUE(waitInfo.completed);
+    }
+    EXPECT_EQ(waitAnyOnlyCompletedCount, kNumFutures);
+}
+
 DAWN_INSTANTIATE_TEST(FutureTests,
                       D3D11Backend(),
                       D3D11Backend({"d3d11_use_unmonitored_fence"}),
@@ -838,6 +838,60 @@ TEST_P(MultithreadEncodingTests, ComputePassEncodersInParallel) {
     }
 }
 
+// Test that encoding draws and dispatches that emit warnings in parallel should work. Encoders
+// validate commands without locking the device so the warnings are emitted concurrently.
+TEST_P(MultithreadEncodingTests, EncodersWithWarningsInParallel) {
+    constexpr uint32_t kRTSize = 4;
+    constexpr uint32_t kNumThreads = 10;
+
+    wgpu::Texture renderTarget = CreateTexture(kRTSize, kRTSize, wgpu::TextureFormat::RGBA8Unorm,
+                                               wgpu::TextureUsage::RenderAttachment);
+    wgpu::TextureView renderTargetView = renderTarget.CreateView();
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main() -> @builtin(position) vec4f {
+            return vec4f(0.0, 0.0, 0.0, 1.0);
+        })");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    pipelineDesc.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    pipelineDesc.primitive.topology = wgpu::PrimitiveTopology::PointList;
+    wgpu::RenderPipeline renderPipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @compute @workgroup_size(1) fn main() {
+        })");
+    wgpu::ComputePipeline computePipeline = device.CreateComputePipeline(&csDesc);
+
+    std::vector<wgpu::CommandBuffer> commandBuffers(kNumThreads);
+
+    utils::RunInParallel(kNumThreads, [=, &commandBuffers](uint32_t index) {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+
+        utils::ComboRenderPassDescriptor renderPass({renderTargetView});
+        for (uint32_t i = 0; i < 10; ++i) {
+            wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+            pass.SetPipeline(renderPipeline);
+            pass.Draw(0);
+            pass.Draw(1, 0);
+            pass.End();
+
+            wgpu::ComputePassEncoder computePass = encoder.BeginComputePass();
+            computePass.SetPipeline(computePipeline);
+            computePass.DispatchWorkgroups(0);
+            computePass.End();
+        }
+
+        commandBuffers[index] = encoder.Finish();
+    });
+
+    queue.Submit(commandBuffers.size(), commandBuffers.data());
+}
+
 class MultithreadTextureCopyTests : public MultithreadTests {
   protected:
     void SetUp() override {
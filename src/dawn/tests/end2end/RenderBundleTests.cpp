@@ -215,7 +215,8 @@ DAWN_INSTANTIATE_TEST(RenderBundleTest,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_record_render_bundles_in_secondary_command_buffers"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,119 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr char kShader[] = R"(
+    override kValue : u32;
+    @group(0) @binding(0) var<storage, read_write> data : array<u32>;
+
+    @compute @workgroup_size(64) fn main(@builtin(global_invocation_id) id : vec3u) {
+        var value = data[id.x];
+        for (var i = 0u; i < kValue % 16u; i++) {
+            value = value * 1664525u + 1013904223u;
+        }
+        data[id.x] = value ^ kValue;
+    }
+)";
+
+struct AsyncPipelineCreationParams : AdapterTestParam {
+    AsyncPipelineCreationParams(const AdapterTestParam& param, uint32_t pipelineCountIn)
+        : AdapterTestParam(param), pipelineCount(pipelineCountIn) {}
+    uint32_t pipelineCount;
+};
+
+std::ostream& operator<<(std::ostream& ostream, const AsyncPipelineCreationParams& param) {
+    ostream << static_cast<const AdapterTestParam&>(param);
+    ostream << "_pipelines_" << param.pipelineCount;
+    return ostream;
+}
+
+// Test the throughput of CreateComputePipelineAsync when an application warms up many pipelines
+// at once. Each step posts |pipelineCount| pipeline creations, which all run on the worker thread
+// pool of the device, and waits for all of them to complete. The pipelines use different values
+// for an override so that none of them hits the pipeline caches.
+class AsyncPipelineCreationPerf : public DawnPerfTestWithParams<AsyncPipelineCreationParams> {
+  public:
+    AsyncPipelineCreationPerf() : DawnPerfTestWithParams(GetParam().pipelineCount, 1) {}
+    ~AsyncPipelineCreationPerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTestWithParams<AsyncPipelineCreationParams>::SetUp();
+        mModule = utils::CreateShaderModule(device, kShader);
+    }
+
+  private:
+    void Step() override {
+        const uint32_t pipelineCount = GetParam().pipelineCount;
+        std::vector<wgpu::ComputePipeline> pipelines(pipelineCount);
+        uint32_t completedCount = 0;
+
+        for (uint32_t i = 0; i < pipelineCount; ++i) {
+            wgpu::ConstantEntry constant;
+            constant.key = "kValue";
+            constant.value = static_cast<double>(mNextConstantValue++);
+
+            wgpu::ComputePipelineDescriptor descriptor;
+            descriptor.compute.module = mModule;
+            descriptor.compute.constantCount = 1;
+            descriptor.compute.constants = &constant;
+
+            device.CreateComputePipelineAsync(
+                &descriptor, wgpu::CallbackMode::AllowProcessEvents,
+                [&pipelines, &completedCount, i](wgpu::CreatePipelineAsyncStatus status,
+                                                 wgpu::ComputePipeline pipeline, const char*) {
+                    EXPECT_EQ(status, wgpu::CreatePipelineAsyncStatus::Success);
+                    pipelines[i] = std::move(pipeline);
+                    completedCount++;
+                });
+        }
+
+        while (completedCount < pipelineCount) {
+            WaitABit();
+        }
+    }
+
+    wgpu::ShaderModule mModule;
+    uint32_t mNextConstantValue = 0;
+};
+
+TEST_P(AsyncPipelineCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(AsyncPipelineCreationPerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {1, 16, 256});
+
+}  // anonymous namespace
+}  // namespace dawn
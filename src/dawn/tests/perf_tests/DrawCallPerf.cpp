@@ -31,6 +31,7 @@
 #include "dawn/common/Assert.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
+#include "dawn/native/DawnNative.h"
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
 #include "dawn/utils/WGPUHelpers.h"
@@ -603,13 +604,28 @@ void DrawCallPerf::Step() {
 }
 
 TEST_P(DrawCallPerf, Run) {
+    native::CommandAllocatorCounters before = native::GetCommandAllocatorCountersForTesting();
     RunTest();
+    native::CommandAllocatorCounters after = native::GetCommandAllocatorCountersForTesting();
+
+    // Report how many command blocks had to come from the system allocator versus being recycled,
+    // since recording many small command buffers is sensitive to malloc/free costs.
+    uint64_t allocated = after.blocksAllocated - before.blocksAllocated;
+    uint64_t recycled = after.blocksRecycled - before.blocksRecycled;
+    PrintResult("command_blocks_allocated", static_cast<double>(allocated), "count", false);
+    PrintResult("command_blocks_recycled", static_cast<double>(recycled), "count", false);
+    if (allocated + recycled > 0) {
+        PrintResult("command_blocks_recycled_ratio",
+                    static_cast<double>(recycled) / static_cast<double>(allocated + recycled),
+                    "ratio", false);
+    }
 }
 
 DAWN_INSTANTIATE_TEST_P(
     DrawCallPerf,
     {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend(),
-     VulkanBackend({"skip_validation"})},
+     VulkanBackend({"skip_validation"}),
+     VulkanBackend({"vulkan_record_render_bundles_in_secondary_command_buffers"})},
     {
         // Baseline
         MakeParam(),
@@ -634,6 +650,9 @@ DAWN_INSTANTIATE_TEST_P(
 
         // ----------- Render Bundles -----------
         // Command validation / state tracking can be futher optimized / precomputed.
+        // Use a static render bundle that can be executed without re-encoding its commands
+        MakeParam(RenderBundle::Yes),  // Baseline w/ render bundle
+
         // Use render bundles with varying vertex buffer binding
         MakeParam(VertexBuffer::Multiple,
                   RenderBundle::Yes),  // Multiple vertex buffers w/ render bundle
@@ -27,8 +27,10 @@
 
 //
 // AsyncTaskTests:
-//     Simple tests for native::AsyncTask and native::AsnycTaskManager.
+//     Simple tests for native::AsyncTask, native::AsnycTaskManager and
+//     platform::AsyncWorkerThreadPool.
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -38,6 +40,7 @@
 #include "dawn/common/NonCopyable.h"
 #include "dawn/native/AsyncTask.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/WorkerThread.h"
 #include "gtest/gtest.h"
 
 namespace dawn {
@@ -103,5 +106,62 @@ TEST_F(AsyncTaskTest, Basic) {
     ASSERT_TRUE(idset.empty());
 }
 
+// Test that the worker thread pool doesn't spawn more threads than its maximum, however many tasks
+// are posted, and that all the tasks still run.
+TEST_F(AsyncTaskTest, WorkerPoolIsBounded) {
+    constexpr uint32_t kMaxThreadCount = 2;
+    platform::AsyncWorkerThreadPool pool(kMaxThreadCount);
+
+    constexpr size_t kTaskCount = 64u;
+    std::atomic<uint32_t> completedCount = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    for (size_t i = 0; i < kTaskCount; ++i) {
+        events.push_back(pool.PostWorkerTask(
+            [](void* userdata) { (*static_cast<std::atomic<uint32_t>*>(userdata))++; },
+            &completedCount));
+    }
+    EXPECT_LE(pool.GetThreadCountForTesting(), kMaxThreadCount);
+
+    for (auto& event : events) {
+        event->Wait();
+        EXPECT_TRUE(event->IsComplete());
+    }
+    EXPECT_EQ(completedCount.load(), kTaskCount);
+    EXPECT_LE(pool.GetThreadCountForTesting(), kMaxThreadCount);
+}
+
+// Test that the tasks still queued when the pool is destroyed are run, and that their events can
+// be used after the pool is gone.
+TEST_F(AsyncTaskTest, WorkerPoolRunsQueuedTasksOnDestruction) {
+    constexpr size_t kTaskCount = 16u;
+    std::atomic<uint32_t> completedCount = 0;
+    std::vector<std::unique_ptr<platform::WaitableEvent>> events;
+    {
+        platform::AsyncWorkerThreadPool pool(1);
+        for (size_t i = 0; i < kTaskCount; ++i) {
+            events.push_back(pool.PostWorkerTask(
+                [](void* userdata) { (*static_cast<std::atomic<uint32_t>*>(userdata))++; },
+                &completedCount));
+        }
+    }
+
+    EXPECT_EQ(completedCount.load(), kTaskCount);
+    for (auto& event : events) {
+        EXPECT_TRUE(event->IsComplete());
+        event->Wait();
+    }
+}
+
+// Test that the pool can be destroyed from one of its own tasks, which happens when a task drops
+// the last reference to the device owning the pool.
+TEST_F(AsyncTaskTest, WorkerPoolDestroyedFromTask) {
+    auto* pool = new platform::AsyncWorkerThreadPool(1);
+    std::unique_ptr<platform::WaitableEvent> event = pool->PostWorkerTask(
+        [](void* userdata) { delete static_cast<platform::AsyncWorkerThreadPool*>(userdata); },
+        pool);
+    event->Wait();
+    EXPECT_TRUE(event->IsComplete());
+}
+
 }  // anonymous namespace
 }  // namespace dawn
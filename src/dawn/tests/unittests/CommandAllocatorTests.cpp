@@ -26,10 +26,12 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "dawn/native/CommandAllocator.h"
+#include "dawn/native/DawnNative.h"
 #include "gtest/gtest.h"
 
 namespace dawn::native {
@@ -513,4 +515,54 @@ TEST(CommandAllocator, AcquireCommandBlocks) {
     iterator.MakeEmptyAsDataWasDestroyed();
 }
 
+// Test that the blocks of destroyed command buffers are reused by the next allocators on the
+// same thread instead of being allocated again.
+TEST(CommandAllocator, BlocksAreRecycled) {
+    // Use a fresh thread so that the blocks cached by previous tests don't interfere.
+    std::thread([] {
+        auto RecordAndDestroy = [] {
+            CommandAllocator allocator;
+            for (size_t i = 0; i < 100; ++i) {
+                CommandDraw* draw = allocator.Allocate<CommandDraw>(CommandType::Draw);
+                draw->first = i;
+                draw->count = i;
+            }
+            CommandIterator iterator(std::move(allocator));
+            iterator.MakeEmptyAsDataWasDestroyed();
+        };
+
+        RecordAndDestroy();
+        CommandAllocatorCounters before = GetCommandAllocatorCountersForTesting();
+        for (size_t i = 0; i < 10; ++i) {
+            RecordAndDestroy();
+        }
+        CommandAllocatorCounters after = GetCommandAllocatorCountersForTesting();
+
+        EXPECT_EQ(after.blocksAllocated, before.blocksAllocated);
+        EXPECT_EQ(after.bytesAllocated, before.bytesAllocated);
+        EXPECT_EQ(after.blocksRecycled, before.blocksRecycled + 10);
+    }).join();
+}
+
+// Test that allocators that are reset without being iterated also return their blocks.
+TEST(CommandAllocator, ResetRecyclesBlocks) {
+    std::thread([] {
+        {
+            CommandAllocator allocator;
+            allocator.Allocate<CommandDraw>(CommandType::Draw);
+        }
+        CommandAllocatorCounters before = GetCommandAllocatorCountersForTesting();
+        {
+            CommandAllocator allocator;
+            allocator.Allocate<CommandDraw>(CommandType::Draw);
+            allocator.Reset();
+            allocator.Allocate<CommandDraw>(CommandType::Draw);
+        }
+        CommandAllocatorCounters after = GetCommandAllocatorCountersForTesting();
+
+        EXPECT_EQ(after.blocksAllocated, before.blocksAllocated);
+        EXPECT_EQ(after.blocksRecycled, before.blocksRecycled + 2);
+    }).join();
+}
+
 }  // namespace dawn::native
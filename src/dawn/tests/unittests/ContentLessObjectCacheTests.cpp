@@ -195,6 +195,52 @@ TEST(ContentLessObjectCacheTest, InsertingAndFinding) {
     }
 }
 
+// Finding the same elements from multiple threads while other threads insert and erase unrelated
+// elements should always return the cached elements.
+TEST(ContentLessObjectCacheTest, FindingWhileInsertingAndErasing) {
+    constexpr size_t kNumObjects = 100;
+    constexpr size_t kNumThreads = 4;
+    ContentLessObjectCache<CacheableT> cache;
+
+    std::vector<Ref<CacheableT>> objects;
+    for (size_t i = 0; i < kNumObjects; i++) {
+        Ref<CacheableT> object = AcquireRef(new CacheableT(i));
+        object->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+        EXPECT_TRUE(cache.Insert(object.Get()).second);
+        objects.push_back(std::move(object));
+    }
+
+    auto finder = [&] {
+        for (size_t iteration = 0; iteration < 10; iteration++) {
+            for (size_t i = 0; i < kNumObjects; i++) {
+                CacheableT blueprint(i);
+                Ref<CacheableT> cached = cache.Find(&blueprint);
+                EXPECT_EQ(cached.Get(), objects[i].Get());
+            }
+        }
+    };
+    auto inserter = [&](size_t t) {
+        for (size_t i = 0; i < kNumObjects; i++) {
+            // The inserted values don't overlap with the values of the found objects.
+            Ref<CacheableT> object = AcquireRef(new CacheableT((t + 1) * kNumObjects + i));
+            object->SetDeleteFn([&](CacheableT* x) { cache.Erase(x); });
+            EXPECT_TRUE(cache.Insert(object.Get()).second);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kNumThreads; t++) {
+        threads.emplace_back(finder);
+        threads.emplace_back(inserter, t);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    objects.clear();
+    EXPECT_TRUE(cache.Empty());
+}
+
 // Finding an element that is in the process of deletion should return nullptr.
 TEST(ContentLessObjectCacheTest, FindDeleting) {
     BinarySemaphore semA, semB;
@@ -0,0 +1,308 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dawn/utils/SharedMemoryRing.h"
+#include "gtest/gtest.h"
+
+namespace dawn::utils {
+namespace {
+
+constexpr uint64_t kInfiniteTimeout = std::numeric_limits<uint64_t>::max();
+
+// A command handler that records the frames it is given.
+class RecordingHandler : public dawn::wire::CommandHandler {
+  public:
+    const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+        frames.emplace_back(size);
+        for (size_t i = 0; i < size; ++i) {
+            frames.back()[i] = commands[i];
+        }
+        return commands + size;
+    }
+
+    std::vector<std::vector<char>> frames;
+};
+
+// Writes a command of |size| bytes filled with |value|.
+bool WriteCommand(SharedMemoryRingSerializer* serializer, size_t size, char value) {
+    void* command = serializer->GetCmdSpace(size);
+    if (command == nullptr) {
+        return false;
+    }
+    memset(command, value, size);
+    return true;
+}
+
+// Test that the rings have a power of two capacity of at least a page.
+TEST(SharedMemoryRingTests, Capacity) {
+    EXPECT_EQ(SharedMemoryRing::Create(1)->GetCapacity(), 4096u);
+    EXPECT_EQ(SharedMemoryRing::Create(5000)->GetCapacity(), 8192u);
+    EXPECT_EQ(SharedMemoryRing::Create(16384)->GetCapacity(), 16384u);
+}
+
+// Test that frames published by the serializer are handed to the handler one at a time, with the
+// commands they contain in order.
+TEST(SharedMemoryRingTests, FramesAndCommands) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+    SharedMemoryRingReceiver receiver(ring.get());
+    RecordingHandler handler;
+
+    EXPECT_FALSE(receiver.WaitForCommands(0));
+
+    ASSERT_TRUE(WriteCommand(&serializer, 8, 1));
+    ASSERT_TRUE(WriteCommand(&serializer, 16, 2));
+    ASSERT_TRUE(serializer.Flush());
+    ASSERT_TRUE(WriteCommand(&serializer, 4, 3));
+    ASSERT_TRUE(serializer.Flush());
+
+    EXPECT_TRUE(receiver.WaitForCommands(0));
+    EXPECT_TRUE(receiver.ProcessCommands(&handler));
+    EXPECT_FALSE(receiver.WaitForCommands(0));
+
+    ASSERT_EQ(handler.frames.size(), 2u);
+    std::vector<char> expected0(24, 1);
+    std::fill(expected0.begin() + 8, expected0.end(), 2);
+    EXPECT_EQ(handler.frames[0], expected0);
+    EXPECT_EQ(handler.frames[1], std::vector<char>(4, 3));
+}
+
+// Test that frames wrap around the end of the ring many times without being split.
+TEST(SharedMemoryRingTests, WrapAround) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+    SharedMemoryRingReceiver receiver(ring.get());
+
+    // Sizes that are not a divisor of the capacity so that frames end at all sorts of offsets.
+    const size_t sizes[] = {1000, 24, 700, 1024, 3, 999};
+    for (uint32_t i = 0; i < 100; ++i) {
+        size_t size = sizes[i % std::size(sizes)];
+        ASSERT_TRUE(WriteCommand(&serializer, size, static_cast<char>(i)));
+        ASSERT_TRUE(serializer.Flush());
+
+        RecordingHandler handler;
+        ASSERT_TRUE(receiver.ProcessCommands(&handler));
+        ASSERT_EQ(handler.frames.size(), 1u);
+        EXPECT_EQ(handler.frames[0], std::vector<char>(size, static_cast<char>(i)));
+    }
+}
+
+// Test that commands larger than the maximum allocation size are rejected. The wire splits them
+// into smaller commands.
+TEST(SharedMemoryRingTests, CommandTooLarge) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+
+    EXPECT_LT(serializer.GetMaximumAllocationSize(), ring->GetCapacity());
+    EXPECT_EQ(serializer.GetCmdSpace(serializer.GetMaximumAllocationSize() + 1), nullptr);
+    EXPECT_EQ(serializer.GetCmdSpace(ring->GetCapacity() * 2), nullptr);
+    EXPECT_NE(serializer.GetCmdSpace(serializer.GetMaximumAllocationSize()), nullptr);
+}
+
+// Test that the receiver rejects frames whose header claims more data than the ring holds, since
+// the producer may be in another, untrusted, process.
+TEST(SharedMemoryRingTests, MalformedFrame) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+    SharedMemoryRingReceiver receiver(ring.get());
+    RecordingHandler handler;
+
+    char* command = static_cast<char*>(serializer.GetCmdSpace(16));
+    ASSERT_NE(command, nullptr);
+    ASSERT_TRUE(serializer.Flush());
+
+    // The 8 bytes before the command hold the size of the frame's payload.
+    uint32_t payloadSize = static_cast<uint32_t>(ring->GetCapacity());
+    memcpy(command - 8, &payloadSize, sizeof(payloadSize));
+
+    EXPECT_FALSE(receiver.ProcessCommands(&handler));
+    EXPECT_TRUE(handler.frames.empty());
+}
+
+// Test that only files containing a valid ring can be imported.
+TEST(SharedMemoryRingTests, Import) {
+    auto ring = SharedMemoryRing::Create(4096);
+    auto imported = SharedMemoryRing::Import(dup(ring->GetFd()));
+    ASSERT_NE(imported, nullptr);
+    EXPECT_EQ(imported->GetCapacity(), ring->GetCapacity());
+
+    // Frames written through one mapping are read through the other.
+    SharedMemoryRingSerializer serializer(ring.get());
+    SharedMemoryRingReceiver receiver(imported.get());
+    RecordingHandler handler;
+    ASSERT_TRUE(WriteCommand(&serializer, 32, 7));
+    ASSERT_TRUE(serializer.Flush());
+    EXPECT_TRUE(receiver.ProcessCommands(&handler));
+    ASSERT_EQ(handler.frames.size(), 1u);
+    EXPECT_EQ(handler.frames[0], std::vector<char>(32, 7));
+
+    // A file of the right size that doesn't contain a ring.
+    int fd = static_cast<int>(syscall(SYS_memfd_create, "not_a_ring", MFD_CLOEXEC));
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, 64 * 1024), 0);
+    EXPECT_EQ(SharedMemoryRing::Import(fd), nullptr);
+}
+
+// Test that the producer waits for the consumer when the ring is full.
+TEST(SharedMemoryRingTests, BackpressureWhenFull) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+    SharedMemoryRingReceiver receiver(ring.get());
+
+    // Each frame takes a quarter of the ring with its header, so the fifth one doesn't fit.
+    const size_t commandSize = serializer.GetMaximumAllocationSize() - 8;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(WriteCommand(&serializer, commandSize, static_cast<char>(i)));
+        ASSERT_TRUE(serializer.Flush());
+    }
+
+    std::atomic<bool> written = false;
+    std::thread producer([&] {
+        EXPECT_TRUE(WriteCommand(&serializer, commandSize, 4));
+        EXPECT_TRUE(serializer.Flush());
+        written = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(written.load());
+
+    RecordingHandler handler;
+    EXPECT_TRUE(receiver.ProcessCommands(&handler));
+    producer.join();
+    EXPECT_TRUE(written.load());
+    EXPECT_TRUE(receiver.ProcessCommands(&handler));
+
+    ASSERT_EQ(handler.frames.size(), 5u);
+    for (size_t i = 0; i < handler.frames.size(); ++i) {
+        EXPECT_EQ(handler.frames[i], std::vector<char>(commandSize, static_cast<char>(i)));
+    }
+}
+
+// Test that Close() wakes a consumer waiting for commands.
+TEST(SharedMemoryRingTests, CloseWakesConsumer) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingReceiver receiver(ring.get());
+
+    std::thread consumer([&] { EXPECT_FALSE(receiver.WaitForCommands(kInfiniteTimeout)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ring->Close();
+    consumer.join();
+    EXPECT_TRUE(ring->IsClosed());
+}
+
+// Test that Close() wakes a producer waiting for space, and that it can't write anymore.
+TEST(SharedMemoryRingTests, CloseWakesProducer) {
+    auto ring = SharedMemoryRing::Create(4096);
+    SharedMemoryRingSerializer serializer(ring.get());
+
+    const size_t commandSize = serializer.GetMaximumAllocationSize() - 8;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(WriteCommand(&serializer, commandSize, 0));
+        ASSERT_TRUE(serializer.Flush());
+    }
+
+    std::thread producer([&] { EXPECT_EQ(serializer.GetCmdSpace(commandSize), nullptr); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ring->Close();
+    producer.join();
+
+    EXPECT_EQ(serializer.GetCmdSpace(8), nullptr);
+    EXPECT_FALSE(serializer.Flush());
+}
+
+// Test that commands written on one thread are received in order on another, while the producer
+// is repeatedly throttled by the consumer.
+TEST(SharedMemoryRingTests, OrderingAcrossThreads) {
+    constexpr uint32_t kCommandCount = 20000;
+    auto ring = SharedMemoryRing::Create(4096);
+
+    // Each command holds its index and its size so that the consumer can split the frames.
+    std::thread producer([&] {
+        SharedMemoryRingSerializer serializer(ring.get());
+        for (uint32_t i = 0; i < kCommandCount; ++i) {
+            uint32_t size = 8 + 8 * (i % 37);
+            uint32_t* command = static_cast<uint32_t*>(serializer.GetCmdSpace(size));
+            ASSERT_NE(command, nullptr);
+            command[0] = i;
+            command[1] = size;
+            if (i % 5 == 0) {
+                ASSERT_TRUE(serializer.Flush());
+            }
+        }
+        ASSERT_TRUE(serializer.Flush());
+    });
+
+    class CheckingHandler : public dawn::wire::CommandHandler {
+      public:
+        const volatile char* HandleCommands(const volatile char* commands, size_t size) override {
+            size_t offset = 0;
+            while (offset < size) {
+                uint32_t header[2];
+                for (size_t i = 0; i < sizeof(header); ++i) {
+                    reinterpret_cast<char*>(header)[i] = commands[offset + i];
+                }
+                if (header[0] != next || header[1] < sizeof(header) ||
+                    header[1] > size - offset) {
+                    return nullptr;
+                }
+                next++;
+                offset += header[1];
+            }
+            return commands + size;
+        }
+
+        uint32_t next = 0;
+    };
+
+    SharedMemoryRingReceiver receiver(ring.get());
+    CheckingHandler handler;
+    while (handler.next < kCommandCount) {
+        receiver.WaitForCommands(kInfiniteTimeout);
+        if (!receiver.ProcessCommands(&handler)) {
+            break;
+        }
+    }
+    producer.join();
+    EXPECT_EQ(handler.next, kCommandCount);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::utils
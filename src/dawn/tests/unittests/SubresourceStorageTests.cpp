@@ -213,10 +213,13 @@ void CheckLayerCompressed(const SubresourceStorage<T>& s,
 
     uint32_t levelCount = s.GetMipLevelCountForTesting();
 
+    // Compressed layers are iterated with all their levels at once, possibly as part of a run of
+    // consecutive compressed layers with the same data.
     bool seen = false;
     s.Iterate([&](const SubresourceRange& range, const T&) {
-        if (range.aspects == aspect && range.layerCount == 1 && range.levelCount == levelCount &&
-            range.baseArrayLayer == layer && range.baseMipLevel == 0) {
+        if (range.aspects == aspect && range.levelCount == levelCount &&
+            range.baseArrayLayer <= layer && layer < range.baseArrayLayer + range.layerCount &&
+            range.baseMipLevel == 0) {
             seen = true;
         }
     });
@@ -504,6 +507,55 @@ TEST(SubresourceStorageTest, UpdateLevel0sHappenToMatch) {
     CheckLayerCompressed(s, Aspect::Color, 1, false);
 }
 
+// Test that Update() and Iterate() handle runs of compressed layers with the same data with a
+// single call, while layers with different data or decompressed layers split the runs.
+TEST(SubresourceStorageTest, CompressedLayerRunsAreCoalesced) {
+    const uint32_t kLayers = 8;
+    const uint32_t kLevels = 3;
+    SubresourceStorage<int> s(Aspect::Color, kLayers, kLevels);
+    FakeStorage<int> f(Aspect::Color, kLayers, kLevels);
+
+    // Decompress layer 3 and give layer 6 a different value than its neighbors.
+    {
+        SubresourceRange range = SubresourceRange::MakeSingle(Aspect::Color, 3, 1);
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data = 1; });
+    }
+    {
+        SubresourceRange range(Aspect::Color, {6, 1}, {0, kLevels});
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data = 2; });
+    }
+
+    // Layers [0, 3), 3 (per level), [4, 6), 6 and 7 are iterated separately.
+    std::vector<SubresourceRange> ranges;
+    s.Iterate([&](const SubresourceRange& range, const int&) { ranges.push_back(range); });
+    ASSERT_EQ(ranges.size(), 1u + kLevels + 3u);
+    EXPECT_EQ(ranges[0].baseArrayLayer, 0u);
+    EXPECT_EQ(ranges[0].layerCount, 3u);
+    EXPECT_EQ(ranges[0].levelCount, kLevels);
+    EXPECT_EQ(ranges[kLevels + 1].baseArrayLayer, 4u);
+    EXPECT_EQ(ranges[kLevels + 1].layerCount, 2u);
+    EXPECT_EQ(ranges[kLevels + 2].baseArrayLayer, 6u);
+    EXPECT_EQ(ranges[kLevels + 2].layerCount, 1u);
+
+    // Updating all the layers calls updateFunc once per run and once per level of layer 3.
+    {
+        uint32_t updateCount = 0;
+        SubresourceRange range = SubresourceRange::MakeFull(Aspect::Color, kLayers, kLevels);
+        s.Update(range, [&](const SubresourceRange&, int* data) {
+            updateCount++;
+            *data += 10;
+        });
+        f.Update(range, [](const SubresourceRange&, int* data) { *data += 10; });
+        f.CheckSameAs(s);
+        EXPECT_EQ(updateCount, 1u + kLevels + 3u);
+    }
+
+    CheckLayerCompressed(s, Aspect::Color, 0, true);
+    CheckLayerCompressed(s, Aspect::Color, 3, false);
+    CheckLayerCompressed(s, Aspect::Color, 5, true);
+    CheckLayerCompressed(s, Aspect::Color, 6, true);
+}
+
 // The tests for Merge() all follow the same as the Update() tests except that they use Update()
 // to set up the test storages.
 
@@ -0,0 +1,103 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "dawn/platform/tracing/TraceRecorder.h"
+#include "gtest/gtest.h"
+
+namespace dawn::platform::tracing {
+namespace {
+
+std::string WriteJSON(const TraceRecorder& recorder) {
+    std::ostringstream stream;
+    recorder.WriteJSON(stream);
+    return stream.str();
+}
+
+size_t CountOccurrences(const std::string& string, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = string.find(pattern); pos != std::string::npos;
+         pos = string.find(pattern, pos + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+
+// Test that scoped trace events are recorded as begin and end events.
+TEST(TraceRecorderTests, RecordsScopedEvents) {
+    TraceRecorder recorder("");
+    { TRACE_EVENT0(&recorder, Validation, "TraceRecorderTests::Scoped"); }
+
+    std::string json = WriteJSON(recorder);
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"TraceRecorderTests::Scoped\""), 2u);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), 1u);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), 1u);
+    EXPECT_EQ(CountOccurrences(json, "\"cat\":\"validation\""), 2u);
+}
+
+// Test that the numeric arguments of trace events are recorded.
+TEST(TraceRecorderTests, RecordsNumericArguments) {
+    TraceRecorder recorder("");
+    TRACE_EVENT_INSTANT1(&recorder, General, "TraceRecorderTests::Args", "count", 42u);
+
+    std::string json = WriteJSON(recorder);
+    EXPECT_EQ(CountOccurrences(json, "\"args\":{\"count\":42}"), 1u);
+}
+
+// Test that each thread records its events in its own buffer.
+TEST(TraceRecorderTests, RecordsEventsOfEachThread) {
+    TraceRecorder recorder("");
+    TRACE_EVENT_INSTANT0(&recorder, General, "TraceRecorderTests::MainThread");
+    std::thread([&] {
+        TRACE_EVENT_INSTANT0(&recorder, General, "TraceRecorderTests::OtherThread");
+    }).join();
+
+    std::string json = WriteJSON(recorder);
+    EXPECT_EQ(CountOccurrences(json, "\"tid\":1,"), 1u);
+    EXPECT_EQ(CountOccurrences(json, "\"tid\":2,"), 1u);
+    EXPECT_EQ(CountOccurrences(json, "TraceRecorderTests::OtherThread"), 1u);
+}
+
+// Test that the oldest events are overwritten when the buffer of a thread is full.
+TEST(TraceRecorderTests, OverwritesOldestEvents) {
+    TraceRecorder recorder("");
+    TRACE_EVENT_INSTANT0(&recorder, General, "TraceRecorderTests::Oldest");
+    for (size_t i = 0; i < TraceRecorder::kEventsPerThread; ++i) {
+        TRACE_EVENT_INSTANT0(&recorder, General, "TraceRecorderTests::Newer");
+    }
+
+    std::string json = WriteJSON(recorder);
+    EXPECT_EQ(CountOccurrences(json, "TraceRecorderTests::Oldest"), 0u);
+    EXPECT_EQ(CountOccurrences(json, "TraceRecorderTests::Newer"), TraceRecorder::kEventsPerThread);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::platform::tracing
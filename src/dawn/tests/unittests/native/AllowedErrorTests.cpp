@@ -39,6 +39,7 @@
 #include "mocks/DeviceMock.h"
 #include "mocks/ExternalTextureMock.h"
 #include "mocks/PipelineLayoutMock.h"
+#include "mocks/QueueMock.h"
 #include "mocks/RenderPipelineMock.h"
 #include "mocks/ShaderModuleMock.h"
 #include "mocks/TextureMock.h"
@@ -49,6 +50,7 @@ namespace {
 using ::testing::_;
 using ::testing::ByMove;
 using ::testing::HasSubstr;
+using ::testing::Mock;
 using ::testing::MockCallback;
 using ::testing::MockCppCallback;
 using ::testing::NiceMock;
@@ -258,6 +260,30 @@ TEST_F(AllowedErrorTests, CreateRenderPipeline) {
     device.CreateRenderPipeline(ToCppAPI(&desc));
 }
 
+// Errors while ProcessEvents updates the completed serial of a queue cause a device lost. The
+// AllowProcessEvents device lost event is made ready from inside ProcessEvents and completed by it.
+TEST_F(AllowedErrorTests, ProcessEventsCheckPassedSerials) {
+    QueueMock* queueMock = mDeviceMock->GetQueueMock();
+
+    // Make the work done event wait on the pending serial so that ProcessEvents needs to check it.
+    EXPECT_CALL(*queueMock, HasPendingCommands).WillRepeatedly(Return(true));
+    MockCppCallback<void (*)(wgpu::QueueWorkDoneStatus)> workDoneCb;
+    device.GetQueue().OnSubmittedWorkDone(wgpu::CallbackMode::AllowProcessEvents,
+                                          workDoneCb.Callback());
+
+    EXPECT_CALL(*queueMock, CheckAndUpdateCompletedSerials)
+        .WillOnce(Return(ByMove(DAWN_INTERNAL_ERROR(kInternalErrorMessage))));
+
+    // Expect the device lost because of the error, and the work done event to complete.
+    EXPECT_CALL(mDeviceLostCb,
+                Call(WGPUDeviceLostReason_Unknown, HasSubstr(kInternalErrorMessage), this))
+        .Times(1);
+    EXPECT_CALL(workDoneCb, Call).Times(1);
+    ProcessEvents();
+
+    Mock::VerifyAndClearExpectations(queueMock);
+}
+
 // Internal error from synchronously initializing a compute pipeline should not result in a device
 // loss.
 TEST_F(AllowedErrorTests, CreateComputePipelineInternalError) {
@@ -0,0 +1,165 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "dawn/common/Version_autogen.h"
+#include "dawn/native/BlobCache.h"
+#include "dawn/native/CacheKey.h"
+#include "dawn/native/dawn_platform.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+// Simple backing store that counts the calls made by the BlobCache.
+struct FakeStore {
+    std::map<std::vector<uint8_t>, std::vector<uint8_t>> entries;
+    size_t loadCount = 0;
+    size_t storeCount = 0;
+
+    static size_t Load(const void* key, size_t keySize, void* value, size_t valueSize, void* ud) {
+        auto* store = static_cast<FakeStore*>(ud);
+        store->loadCount++;
+        const uint8_t* keyBytes = static_cast<const uint8_t*>(key);
+        auto it = store->entries.find(std::vector<uint8_t>(keyBytes, keyBytes + keySize));
+        if (it == store->entries.end()) {
+            return 0;
+        }
+        if (value != nullptr && valueSize >= it->second.size()) {
+            memcpy(value, it->second.data(), it->second.size());
+        }
+        return it->second.size();
+    }
+
+    static void Store(const void* key, size_t keySize, const void* value, size_t valueSize,
+                      void* ud) {
+        auto* store = static_cast<FakeStore*>(ud);
+        store->storeCount++;
+        const uint8_t* keyBytes = static_cast<const uint8_t*>(key);
+        const uint8_t* valueBytes = static_cast<const uint8_t*>(value);
+        store->entries[std::vector<uint8_t>(keyBytes, keyBytes + keySize)] =
+            std::vector<uint8_t>(valueBytes, valueBytes + valueSize);
+    }
+};
+
+CacheKey MakeKey(uint32_t id) {
+    CacheKey key;
+    StreamIn(&key, kDawnVersion, id);
+    return key;
+}
+
+DawnCacheDeviceDescriptor MakeDescriptor(FakeStore* store, size_t memoryCacheSize) {
+    DawnCacheDeviceDescriptor desc = {};
+    desc.loadDataFunction = FakeStore::Load;
+    desc.storeDataFunction = FakeStore::Store;
+    desc.functionUserdata = store;
+    desc.memoryCacheSize = memoryCacheSize;
+    return desc;
+}
+
+// Without a memory cache, every load goes through the load function, twice when it hits.
+TEST(BlobCacheTests, NoMemoryCache) {
+    FakeStore store;
+    BlobCache cache(MakeDescriptor(&store, 0));
+
+    const uint32_t value = 42;
+    cache.Store(MakeKey(0), sizeof(value), &value);
+    EXPECT_EQ(store.storeCount, 1u);
+
+    for (size_t i = 0; i < 3; i++) {
+        Blob blob = cache.Load(MakeKey(0));
+        ASSERT_EQ(blob.Size(), sizeof(value));
+        EXPECT_EQ(memcmp(blob.Data(), &value, sizeof(value)), 0);
+    }
+    EXPECT_EQ(store.loadCount, 6u);
+}
+
+// Blobs that were stored or loaded are served from the memory cache without calling the load
+// function again.
+TEST(BlobCacheTests, MemoryCacheHits) {
+    FakeStore store;
+    BlobCache cache(MakeDescriptor(&store, 1024));
+
+    const uint32_t value = 42;
+    cache.Store(MakeKey(0), sizeof(value), &value);
+    EXPECT_EQ(store.storeCount, 1u);
+
+    // Stores still go through to the store function, and later loads are memory cache hits.
+    for (size_t i = 0; i < 3; i++) {
+        Blob blob = cache.Load(MakeKey(0));
+        ASSERT_EQ(blob.Size(), sizeof(value));
+        EXPECT_EQ(memcmp(blob.Data(), &value, sizeof(value)), 0);
+    }
+    EXPECT_EQ(store.loadCount, 0u);
+
+    // Blobs that were only in the backing store are loaded once then kept in memory.
+    FakeStore::Store(MakeKey(1).data(), MakeKey(1).size(), &value, sizeof(value), &store);
+    EXPECT_EQ(cache.Load(MakeKey(1)).Size(), sizeof(value));
+    EXPECT_EQ(cache.Load(MakeKey(1)).Size(), sizeof(value));
+    EXPECT_EQ(store.loadCount, 2u);
+
+    // Misses are not cached.
+    EXPECT_TRUE(cache.Load(MakeKey(2)).Empty());
+    EXPECT_TRUE(cache.Load(MakeKey(2)).Empty());
+    EXPECT_EQ(store.loadCount, 4u);
+}
+
+// The least recently used entries are evicted when the memory cache is full.
+TEST(BlobCacheTests, MemoryCacheEviction) {
+    FakeStore store;
+    const size_t entrySize = MakeKey(0).size() + 16;
+    BlobCache cache(MakeDescriptor(&store, 2 * entrySize));
+
+    const std::vector<uint8_t> value(16, 0xAB);
+    cache.Store(MakeKey(0), value.size(), value.data());
+    cache.Store(MakeKey(1), value.size(), value.data());
+
+    // Touch 0 so that 1 becomes the least recently used entry, then store 2 which evicts 1.
+    EXPECT_FALSE(cache.Load(MakeKey(0)).Empty());
+    cache.Store(MakeKey(2), value.size(), value.data());
+    EXPECT_EQ(store.loadCount, 0u);
+
+    EXPECT_FALSE(cache.Load(MakeKey(0)).Empty());
+    EXPECT_FALSE(cache.Load(MakeKey(2)).Empty());
+    EXPECT_EQ(store.loadCount, 0u);
+
+    EXPECT_FALSE(cache.Load(MakeKey(1)).Empty());
+    EXPECT_EQ(store.loadCount, 2u);
+
+    // Entries larger than the memory cache are never kept in memory.
+    const std::vector<uint8_t> largeValue(4 * entrySize, 0xCD);
+    cache.Store(MakeKey(3), largeValue.size(), largeValue.data());
+    EXPECT_EQ(cache.Load(MakeKey(3)).Size(), largeValue.size());
+    EXPECT_EQ(store.loadCount, 4u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
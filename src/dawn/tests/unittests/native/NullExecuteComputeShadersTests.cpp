@@ -0,0 +1,141 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <vector>
+
+#include "dawn/native/null/DeviceNull.h"
+#include "dawn/tests/DawnNativeTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native {
+namespace {
+
+class NullExecuteComputeShadersTests : public DawnNativeTest {
+  protected:
+    void SetUp() override {
+        DawnNativeTest::SetUp();
+
+        const char* executeComputeShadersToggle = "null_execute_compute_shaders";
+        wgpu::DawnTogglesDescriptor deviceToggles;
+        deviceToggles.enabledToggleCount = 1;
+        deviceToggles.enabledToggles = &executeComputeShadersToggle;
+
+        wgpu::DeviceDescriptor desc;
+        desc.nextInChain = &deviceToggles;
+        desc.SetUncapturedErrorCallback(
+            [](const wgpu::Device&, wgpu::ErrorType, const char* message) {
+                FAIL() << "Unexpected error: " << message;
+            });
+        device = wgpu::Device::Acquire(adapter.CreateDevice(&desc));
+    }
+
+    std::vector<uint32_t> GetContents(const wgpu::Buffer& buffer) {
+        const uint32_t* data = reinterpret_cast<const uint32_t*>(
+            static_cast<null::Buffer*>(FromAPI(buffer.Get()))->GetData());
+        return std::vector<uint32_t>(data, data + buffer.GetSize() / sizeof(uint32_t));
+    }
+};
+
+// Test that a compute dispatch reads and writes the bound storage buffers, and that buffer copies
+// are executed in order with the dispatches.
+TEST_F(NullExecuteComputeShadersTests, DispatchAndCopy) {
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<storage, read> input : array<u32>;
+        @group(0) @binding(1) var<storage, read_write> output : array<u32>;
+
+        @compute @workgroup_size(4)
+        fn main(@builtin(global_invocation_id) id : vec3u) {
+            output[id.x] = input[id.x] * 2u + 1u;
+        })");
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&csDesc);
+
+    wgpu::Buffer input = utils::CreateBufferFromData<uint32_t>(
+        device, wgpu::BufferUsage::Storage, {1, 2, 3, 4, 5, 6, 7, 8});
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 8 * sizeof(uint32_t);
+    bufferDesc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc;
+    wgpu::Buffer output = device.CreateBuffer(&bufferDesc);
+    bufferDesc.usage = wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer copy = device.CreateBuffer(&bufferDesc);
+
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0),
+                                                     {{0, input}, {1, output}});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    pass.SetPipeline(pipeline);
+    pass.SetBindGroup(0, bindGroup);
+    pass.DispatchWorkgroups(2);
+    pass.End();
+    encoder.CopyBufferToBuffer(output, 0, copy, 0, bufferDesc.size);
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.GetQueue().Submit(1, &commands);
+
+    std::vector<uint32_t> expected = {3, 5, 7, 9, 11, 13, 15, 17};
+    EXPECT_EQ(GetContents(output), expected);
+    EXPECT_EQ(GetContents(copy), expected);
+}
+
+// Test that indirect dispatches use the workgroup counts of the indirect buffer.
+TEST_F(NullExecuteComputeShadersTests, DispatchIndirect) {
+    wgpu::ComputePipelineDescriptor csDesc;
+    csDesc.compute.module = utils::CreateShaderModule(device, R"(
+        @group(0) @binding(0) var<storage, read_write> output : array<u32>;
+
+        @compute @workgroup_size(2)
+        fn main(@builtin(global_invocation_id) id : vec3u,
+                @builtin(num_workgroups) count : vec3u) {
+            output[id.x] = count.x;
+        })");
+    wgpu::ComputePipeline pipeline = device.CreateComputePipeline(&csDesc);
+
+    wgpu::Buffer indirect =
+        utils::CreateBufferFromData<uint32_t>(device, wgpu::BufferUsage::Indirect, {0, 3, 1, 1});
+    wgpu::BufferDescriptor bufferDesc;
+    bufferDesc.size = 8 * sizeof(uint32_t);
+    bufferDesc.usage = wgpu::BufferUsage::Storage;
+    wgpu::Buffer output = device.CreateBuffer(&bufferDesc);
+
+    wgpu::BindGroup bindGroup =
+        utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0), {{0, output}});
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+    pass.SetPipeline(pipeline);
+    pass.SetBindGroup(0, bindGroup);
+    pass.DispatchWorkgroupsIndirect(indirect, sizeof(uint32_t));
+    pass.End();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    device.GetQueue().Submit(1, &commands);
+
+    EXPECT_EQ(GetContents(output), (std::vector<uint32_t>{3, 3, 3, 3, 3, 3, 0, 0}));
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
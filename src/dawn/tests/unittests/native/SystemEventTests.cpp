@@ -0,0 +1,99 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <thread>
+#include <utility>
+
+#include "dawn/native/SystemEvent.h"
+#include "dawn/native/WaitAnySystemEvent.h"
+#include "gtest/gtest.h"
+
+namespace dawn::native {
+namespace {
+
+// Polls `receiver` without waiting and returns whether it is signaled.
+bool IsReceiverSignaled(const SystemEventReceiver& receiver) {
+    bool ready = false;
+    std::array<std::pair<const SystemEventReceiver&, bool*>, 1> events{{{receiver, &ready}}};
+    return WaitAnySystemEvent(events.begin(), events.end(), Nanoseconds(0)) && ready;
+}
+
+// Test that a receiver is signaled once its sender is.
+TEST(SystemEventTests, PipeSignal) {
+    auto [sender, receiver] = CreateSystemEventPipe();
+    EXPECT_FALSE(IsReceiverSignaled(receiver));
+    std::move(sender).Signal();
+    EXPECT_TRUE(IsReceiverSignaled(receiver));
+    // Receivers stay signaled.
+    EXPECT_TRUE(IsReceiverSignaled(receiver));
+}
+
+// Test CreateAlreadySignaled.
+TEST(SystemEventTests, AlreadySignaledReceiver) {
+    SystemEventReceiver receiver = SystemEventReceiver::CreateAlreadySignaled();
+    EXPECT_TRUE(IsReceiverSignaled(receiver));
+}
+
+// Test that the receiver of a SystemEvent is signaled whether it is created before or after the
+// SystemEvent is signaled.
+TEST(SystemEventTests, SystemEventReceiver) {
+    Ref<SystemEvent> signaledBefore = AcquireRef(new SystemEvent());
+    signaledBefore->Signal();
+    EXPECT_TRUE(IsReceiverSignaled(signaledBefore->GetOrCreateSystemEventReceiver()));
+
+    Ref<SystemEvent> signaledAfter = AcquireRef(new SystemEvent());
+    const SystemEventReceiver& receiver = signaledAfter->GetOrCreateSystemEventReceiver();
+    EXPECT_FALSE(IsReceiverSignaled(receiver));
+    signaledAfter->Signal();
+    EXPECT_TRUE(IsReceiverSignaled(receiver));
+}
+
+// Test that a timed wait returns once one of the events is signaled from another thread.
+TEST(SystemEventTests, WaitAnySignaledFromOtherThread) {
+    Ref<SystemEvent> event0 = AcquireRef(new SystemEvent());
+    Ref<SystemEvent> event1 = AcquireRef(new SystemEvent());
+
+    bool ready0 = false;
+    bool ready1 = false;
+    std::array<std::pair<const SystemEventReceiver&, bool*>, 2> events{
+        {{event0->GetOrCreateSystemEventReceiver(), &ready0},
+         {event1->GetOrCreateSystemEventReceiver(), &ready1}}};
+
+    std::thread signalThread([&] { event1->Signal(); });
+    EXPECT_TRUE(WaitAnySystemEvent(events.begin(), events.end(), Nanoseconds(UINT64_MAX)));
+    signalThread.join();
+
+    EXPECT_FALSE(ready0);
+    EXPECT_TRUE(ready1);
+
+    // Events must be signaled before they are destroyed.
+    event0->Signal();
+}
+
+}  // anonymous namespace
+}  // namespace dawn::native
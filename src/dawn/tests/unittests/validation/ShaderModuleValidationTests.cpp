@@ -204,6 +204,39 @@ TEST_F(ShaderModuleValidationTest, NonUniformDerivatives_FlagSetToTrue) {
     utils::CreateShaderModuleFromASM(device, kShaderWithNonUniformDerivative, &spirv_options_desc);
 }
 
+// Test that modules created from the same SPIR-V are only deduplicated when their
+// `allowNonUniformDerivatives` flags match, because the flag changes the resulting program.
+TEST_F(ShaderModuleValidationTest, NonUniformDerivatives_PartOfCacheKey) {
+    // Deduplicated modules are only the same object in dawn::native, not in the wire client.
+    DAWN_SKIP_TEST_IF(UsesWire());
+
+    const char* shader = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %main "main"
+               OpExecutionMode %main OriginUpperLeft
+       %void = OpTypeVoid
+  %func_type = OpTypeFunction %void
+       %main = OpFunction %void None %func_type
+      %start = OpLabel
+               OpReturn
+               OpFunctionEnd)";
+
+    wgpu::DawnShaderModuleSPIRVOptionsDescriptor disallow_desc = {};
+    disallow_desc.allowNonUniformDerivatives = false;
+    wgpu::DawnShaderModuleSPIRVOptionsDescriptor allow_desc = {};
+    allow_desc.allowNonUniformDerivatives = true;
+
+    wgpu::ShaderModule noOptions = utils::CreateShaderModuleFromASM(device, shader);
+    wgpu::ShaderModule disallow1 = utils::CreateShaderModuleFromASM(device, shader, &disallow_desc);
+    wgpu::ShaderModule allow1 = utils::CreateShaderModuleFromASM(device, shader, &allow_desc);
+    wgpu::ShaderModule allow2 = utils::CreateShaderModuleFromASM(device, shader, &allow_desc);
+
+    EXPECT_EQ(noOptions.Get(), disallow1.Get());
+    EXPECT_NE(disallow1.Get(), allow1.Get());
+    EXPECT_EQ(allow1.Get(), allow2.Get());
+}
+
 #endif  // TINT_BUILD_SPV_READER
 
 // Test that it is invalid to create a shader module with no chained descriptor. (It must be
@@ -25,11 +25,15 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <cstring>
+#include <vector>
+
 #include "dawn/tests/unittests/wire/WireTest.h"
 
 namespace dawn::wire {
 namespace {
 
+using testing::_;
 using testing::Return;
 
 class WireBasicTests : public WireTest {
@@ -93,5 +97,82 @@ TEST_F(WireBasicTests, ReleaseCalledOnRefCount0) {
     FlushClient();
 }
 
+// Test that consecutive commands too large for a single wire chunk are each forwarded intact.
+TEST_F(WireBasicTests, LargeCommandsForwardedIntact) {
+    WGPUBufferDescriptor descriptor = {};
+    descriptor.size = 4 * 1024 * 1024;
+    descriptor.usage = WGPUBufferUsage_CopyDst;
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device, &descriptor);
+
+    WGPUBuffer apiBuffer = api.GetNewBuffer();
+    EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+    FlushClient();
+
+    // Write a large and then smaller payloads, all bigger than the command buffer used by the
+    // test so that they are sent in chunks and reassembled by the server. The last one isn't a
+    // multiple of the wire alignment so the command ends with padding.
+    for (size_t size :
+         {size_t(3 * 1024 * 1024), size_t(2 * 1024 * 1024), size_t(1024 * 1024 + 4)}) {
+        std::vector<uint8_t> data(size);
+        for (size_t i = 0; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i * 7 + size);
+        }
+        wgpuQueueWriteBuffer(queue, buffer, 0, data.data(), size);
+
+        EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 0, _, size))
+            .WillOnce([&](WGPUQueue, WGPUBuffer, uint64_t, const void* received, size_t) {
+                EXPECT_EQ(0, memcmp(received, data.data(), size));
+            });
+        FlushClient();
+    }
+}
+
+// Test that a WriteTexture too large for a single wire chunk is forwarded intact. Unlike
+// WriteBuffer, its data is followed by other members of the command.
+TEST_F(WireBasicTests, LargeWriteTextureForwardedIntact) {
+    WGPUTextureDescriptor descriptor = {};
+    descriptor.dimension = WGPUTextureDimension_2D;
+    descriptor.size = {1024, 1024, 1};
+    descriptor.format = WGPUTextureFormat_RGBA8Unorm;
+    descriptor.mipLevelCount = 1;
+    descriptor.sampleCount = 1;
+    descriptor.usage = WGPUTextureUsage_CopyDst;
+    WGPUTexture texture = wgpuDeviceCreateTexture(device, &descriptor);
+
+    WGPUTexture apiTexture = api.GetNewTexture();
+    EXPECT_CALL(api, DeviceCreateTexture(apiDevice, _)).WillOnce(Return(apiTexture));
+    FlushClient();
+
+    size_t size = 4 * 1024 * 1024;
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<uint8_t>(i * 13);
+    }
+    WGPUImageCopyTexture destination = {};
+    destination.texture = texture;
+    destination.origin = {1, 2, 0};
+    destination.aspect = WGPUTextureAspect_All;
+    WGPUTextureDataLayout dataLayout = {};
+    dataLayout.bytesPerRow = 4096;
+    dataLayout.rowsPerImage = 1024;
+    WGPUExtent3D writeSize = {1023, 1022, 1};
+    wgpuQueueWriteTexture(queue, &destination, data.data(), size, &dataLayout, &writeSize);
+
+    EXPECT_CALL(api, QueueWriteTexture(apiQueue, _, _, size, _, _))
+        .WillOnce([&](WGPUQueue, const WGPUImageCopyTexture* receivedDestination,
+                      const void* received, size_t, const WGPUTextureDataLayout* receivedLayout,
+                      const WGPUExtent3D* receivedSize) {
+            EXPECT_EQ(apiTexture, receivedDestination->texture);
+            EXPECT_EQ(1u, receivedDestination->origin.x);
+            EXPECT_EQ(2u, receivedDestination->origin.y);
+            EXPECT_EQ(0, memcmp(received, data.data(), size));
+            EXPECT_EQ(4096u, receivedLayout->bytesPerRow);
+            EXPECT_EQ(1024u, receivedLayout->rowsPerImage);
+            EXPECT_EQ(1023u, receivedSize->width);
+            EXPECT_EQ(1022u, receivedSize->height);
+        });
+    FlushClient();
+}
+
 }  // anonymous namespace
 }  // namespace dawn::wire
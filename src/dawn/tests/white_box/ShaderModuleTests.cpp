@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -67,6 +68,51 @@ const char* kComputeShader = R"(
         ssbo.value = 1u;
     })";
 
+#if TINT_BUILD_SPV_READER
+// A fragment shader that is only valid with DawnShaderModuleSPIRVOptionsDescriptor's
+// allowNonUniformDerivatives set.
+const char* kSpirvShaderWithNonUniformDerivative = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint Fragment %foo "foo" %x
+               OpExecutionMode %foo OriginUpperLeft
+               OpDecorate %x Location 0
+      %float = OpTypeFloat 32
+%_ptr_Input_float = OpTypePointer Input %float
+          %x = OpVariable %_ptr_Input_float Input
+       %void = OpTypeVoid
+    %float_0 = OpConstantNull %float
+       %bool = OpTypeBool
+  %func_type = OpTypeFunction %void
+        %foo = OpFunction %void None %func_type
+  %foo_start = OpLabel
+    %x_value = OpLoad %float %x
+  %condition = OpFOrdGreaterThan %bool %x_value %float_0
+               OpSelectionMerge %merge None
+               OpBranchConditional %condition %true_branch %merge
+%true_branch = OpLabel
+     %result = OpDPdx %float %x_value
+               OpBranch %merge
+      %merge = OpLabel
+               OpReturn
+               OpFunctionEnd)";
+#endif  // TINT_BUILD_SPV_READER
+
+// The name, stage and number of inputs and outputs of an entry point of a Tint program.
+using ReflectedEntryPoint =
+    std::tuple<std::string, tint::inspector::PipelineStage, size_t, size_t>;
+
+std::vector<ReflectedEntryPoint> ReflectEntryPoints(const TintProgram* tintProgram) {
+    tint::inspector::Inspector inspector(tintProgram->program);
+    std::vector<ReflectedEntryPoint> entryPoints;
+    for (const auto& entryPoint : inspector.GetEntryPoints()) {
+        entryPoints.emplace_back(entryPoint.name, entryPoint.stage,
+                                 entryPoint.input_variables.size(),
+                                 entryPoint.output_variables.size());
+    }
+    return entryPoints;
+}
+
 struct CreatePipelineAsyncTask {
     wgpu::ComputePipeline computePipeline = nullptr;
     wgpu::RenderPipeline renderPipeline = nullptr;
@@ -207,6 +253,57 @@ TEST_P(ShaderModuleTests, CachedShader) {
     EXPECT_EQ(shaderModule->GetTintProgramRecreateCountForTesting(), 1);
 }
 
+// Check that a re-created mTintProgram reflects the same entry points as the original one.
+TEST_P(ShaderModuleTests, RecreatedTintProgramMatchesOriginal) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kVertexShader);
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto originalEntryPoints = ReflectEntryPoints(shaderModule->GetTintProgram().Get());
+    ASSERT_EQ(originalEntryPoints.size(), 1u);
+
+    // Drop the external reference to release mTintProgram, then get the module from the cache.
+    module = {};
+    EXPECT_FALSE(shaderModule->GetTintProgramForTesting());
+    module = utils::CreateShaderModule(device, kVertexShader);
+    EXPECT_EQ(shaderModule.Get(), FromAPI(module.Get()));
+
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    EXPECT_EQ(shaderModule->GetTintProgramRecreateCountForTesting(), 1);
+    EXPECT_EQ(ReflectEntryPoints(shaderModule->GetTintProgram().Get()), originalEntryPoints);
+
+    // The reflection of the module is unchanged and still usable to create a pipeline.
+    EXPECT_TRUE(shaderModule->HasEntryPoint("main"));
+    EXPECT_EQ(shaderModule->GetEntryPoint("main").stage, SingleShaderStage::Vertex);
+    wgpu::ShaderModule fsModule = utils::CreateShaderModule(device, kFragmentShader);
+    EXPECT_TRUE(DoCreateRenderPipeline(module, fsModule));
+}
+
+#if TINT_BUILD_SPV_READER
+// Check that the mTintProgram of a SPIR-V module is re-created with the SPIR-V options the module
+// was created with. The shader is invalid without them.
+TEST_P(ShaderModuleTests, RecreatedTintProgramKeepsSpirvOptions) {
+    wgpu::DawnShaderModuleSPIRVOptionsDescriptor spirvOptions = {};
+    spirvOptions.allowNonUniformDerivatives = true;
+    wgpu::ShaderModule module = utils::CreateShaderModuleFromASM(
+        device, kSpirvShaderWithNonUniformDerivative, &spirvOptions);
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto originalEntryPoints = ReflectEntryPoints(shaderModule->GetTintProgram().Get());
+    ASSERT_EQ(originalEntryPoints.size(), 1u);
+
+    // Drop the external reference to release mTintProgram, then get the module from the cache.
+    module = {};
+    EXPECT_FALSE(shaderModule->GetTintProgramForTesting());
+    module = utils::CreateShaderModuleFromASM(device, kSpirvShaderWithNonUniformDerivative,
+                                              &spirvOptions);
+    EXPECT_EQ(shaderModule.Get(), FromAPI(module.Get()));
+
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    EXPECT_EQ(shaderModule->GetTintProgramRecreateCountForTesting(), 1);
+    EXPECT_EQ(ReflectEntryPoints(shaderModule->GetTintProgram().Get()), originalEntryPoints);
+    EXPECT_TRUE(shaderModule->HasEntryPoint("foo"));
+    EXPECT_EQ(shaderModule->GetEntryPoint("foo").stage, SingleShaderStage::Fragment);
+}
+#endif  // TINT_BUILD_SPV_READER
+
 // Check mTintProgram in ShaderModule is released after creation of a RenderPipeline is done.
 TEST_P(ShaderModuleTests, CreateRenderPipeline) {
     wgpu::ShaderModule vsModule = utils::CreateShaderModule(device, kVertexShader);
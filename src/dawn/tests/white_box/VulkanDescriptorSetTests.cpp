@@ -0,0 +1,108 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/tests/DawnTest.h"
+
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/vulkan/BindGroupVk.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn::native::vulkan {
+namespace {
+
+class VulkanDescriptorSetTests : public DawnTest {
+  protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+        mLayout = utils::MakeBindGroupLayout(
+            device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Uniform}});
+
+        wgpu::BufferDescriptor descriptor;
+        descriptor.size = 512;
+        descriptor.usage = wgpu::BufferUsage::Uniform;
+        mBuffer = device.CreateBuffer(&descriptor);
+    }
+
+    wgpu::BindGroup MakeBindGroup(uint64_t offset) {
+        return utils::MakeBindGroup(device, mLayout, {{0, mBuffer, offset, 16}});
+    }
+
+    VkDescriptorSet GetHandle(const wgpu::BindGroup& bindGroup) {
+        return ToBackend(FromAPI(bindGroup.Get()))->GetHandle();
+    }
+
+    wgpu::BindGroupLayout mLayout;
+    wgpu::Buffer mBuffer;
+};
+
+// Test that a bind group with the same contents as a destroyed bind group reuses its descriptor
+// set.
+TEST_P(VulkanDescriptorSetTests, IdenticalBindGroupReusesDescriptorSet) {
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    {
+        wgpu::BindGroup bindGroup = MakeBindGroup(0);
+        set = GetHandle(bindGroup);
+    }
+
+    wgpu::BindGroup bindGroup = MakeBindGroup(0);
+    EXPECT_EQ(set, GetHandle(bindGroup));
+}
+
+// Test that a bind group with different contents doesn't reuse the descriptor set of a destroyed
+// bind group.
+TEST_P(VulkanDescriptorSetTests, DifferentBindGroupDoesNotReuseDescriptorSet) {
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    {
+        wgpu::BindGroup bindGroup = MakeBindGroup(0);
+        set = GetHandle(bindGroup);
+    }
+
+    wgpu::BindGroup bindGroup = MakeBindGroup(256);
+    EXPECT_NE(set, GetHandle(bindGroup));
+}
+
+// Test that a reused descriptor set isn't freed when the deallocation of the destroyed bind group
+// it came from finishes.
+TEST_P(VulkanDescriptorSetTests, ReusedDescriptorSetIsNotFreed) {
+    { wgpu::BindGroup bindGroup = MakeBindGroup(0); }
+    wgpu::BindGroup reusingBindGroup = MakeBindGroup(0);
+
+    // Finish the deallocation of the first bind group.
+    queue.Submit(0, nullptr);
+    WaitForAllOperations();
+
+    // The descriptor set is still used by reusingBindGroup and must not be allocated again.
+    wgpu::BindGroup bindGroup = MakeBindGroup(256);
+    EXPECT_NE(GetHandle(reusingBindGroup), GetHandle(bindGroup));
+}
+
+DAWN_INSTANTIATE_TEST(VulkanDescriptorSetTests, VulkanBackend());
+
+}  // anonymous namespace
+}  // namespace dawn::native::vulkan
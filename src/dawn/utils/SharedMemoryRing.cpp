@@ -0,0 +1,369 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/utils/SharedMemoryRing.h"
+
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <ctime>
+#include <limits>
+#include <new>
+
+#include "dawn/common/Assert.h"
+#include "dawn/common/Math.h"
+
+namespace dawn::utils {
+
+namespace {
+
+constexpr uint32_t kRingMagic = 0x52575244;  // "DWRR"
+constexpr uint32_t kMinCapacity = 4096;
+constexpr uint32_t kMaxCapacity = 1u << 30;
+
+// Each frame starts with a header holding the size of its payload. Frames are 8-byte aligned so
+// that the wire commands they contain are aligned to kWireBufferAlignment.
+constexpr uint32_t kFrameHeaderSize = 8;
+constexpr uint32_t kFrameAlignment = 8;
+// Frame header size used to tell the consumer that the rest of the ring is unused and that the
+// next frame starts at the beginning of the ring.
+constexpr uint32_t kWrapMarker = std::numeric_limits<uint32_t>::max();
+
+// Positions are free-running 32-bit counters so they are aligned with wrap-around arithmetic.
+constexpr uint32_t AlignFrame(uint32_t position) {
+    return (position + kFrameAlignment - 1) & ~(kFrameAlignment - 1);
+}
+
+constexpr uint64_t kInfiniteTimeout = std::numeric_limits<uint64_t>::max();
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+long Futex(std::atomic<uint32_t>* word, int op, uint32_t value, const timespec* timeout) {
+    // The futexes are shared between processes so FUTEX_PRIVATE_FLAG must not be used.
+    return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), op, value, timeout, nullptr, 0);
+}
+
+}  // anonymous namespace
+
+struct SharedMemoryRing::Control {
+    // A futex word that is bumped each time the other side makes progress while this side is
+    // waiting. |waiting| avoids the FUTEX_WAKE syscall when nobody is waiting.
+    struct Signal {
+        std::atomic<uint32_t> sequence;
+        std::atomic<uint32_t> waiting;
+    };
+
+    uint32_t magic;
+    uint32_t capacity;
+    std::atomic<uint32_t> closed;
+
+    // Written by the producer, signaled for the consumer.
+    alignas(64) std::atomic<uint32_t> head;
+    Signal headSignal;
+
+    // Written by the consumer, signaled for the producer.
+    alignas(64) std::atomic<uint32_t> tail;
+    Signal tailSignal;
+};
+
+namespace {
+
+constexpr size_t kDataOffset = (sizeof(SharedMemoryRing::Control) + 63) & ~size_t(63);
+
+void Signal(SharedMemoryRing::Control::Signal* signal, bool force) {
+    if (force || signal->waiting.load() != 0) {
+        signal->sequence.fetch_add(1);
+        Futex(&signal->sequence, FUTEX_WAKE, INT_MAX, nullptr);
+    }
+}
+
+// Waits until |isReady| returns true, or |timeoutNs| elapsed. The sequence is read before
+// |isReady| is checked so that a signal sent in between makes FUTEX_WAIT return immediately.
+//
+// Storing |waiting| then checking |isReady| here, and publishing then loading |waiting| in
+// Signal(), is a Dekker-style handshake: at least one side must see the other's store, otherwise
+// the wake is skipped while this side sleeps. This requires all four accesses, including the
+// loads done by |isReady|, to be seq_cst.
+template <typename IsReady>
+bool WaitForSignal(SharedMemoryRing::Control::Signal* signal, uint64_t timeoutNs, IsReady isReady) {
+    if (isReady()) {
+        return true;
+    }
+
+    signal->waiting.store(1);
+    uint32_t sequence = signal->sequence.load();
+    bool ready = isReady();
+    if (!ready) {
+        timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(timeoutNs / 1'000'000'000);
+        timeout.tv_nsec = static_cast<long>(timeoutNs % 1'000'000'000);
+        Futex(&signal->sequence, FUTEX_WAIT, sequence,
+              timeoutNs == kInfiniteTimeout ? nullptr : &timeout);
+        ready = isReady();
+    }
+    signal->waiting.store(0);
+    return ready;
+}
+
+}  // anonymous namespace
+
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Create(size_t capacity) {
+    capacity = std::clamp<size_t>(NextPowerOfTwo(capacity), kMinCapacity, kMaxCapacity);
+    size_t mappingSize = kDataOffset + capacity;
+
+    int fd = static_cast<int>(syscall(SYS_memfd_create, "dawn_wire_ring", MFD_CLOEXEC));
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(mappingSize)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    Control* control = new (mapping) Control();
+    control->magic = kRingMagic;
+    control->capacity = static_cast<uint32_t>(capacity);
+
+    return std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(fd, mapping, mappingSize));
+}
+
+// static
+std::unique_ptr<SharedMemoryRing> SharedMemoryRing::Import(int fd) {
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(kDataOffset + kMinCapacity)) {
+        close(fd);
+        return nullptr;
+    }
+    size_t mappingSize = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto ring = std::unique_ptr<SharedMemoryRing>(new SharedMemoryRing(fd, mapping, mappingSize));
+    // Don't trust the capacity stored in the shared memory: it has to match the size of the file.
+    if (ring->mControl->magic != kRingMagic || !IsPowerOfTwo(ring->mCapacity) ||
+        kDataOffset + ring->mCapacity != mappingSize) {
+        return nullptr;
+    }
+    return ring;
+}
+
+SharedMemoryRing::SharedMemoryRing(int fd, void* mapping, size_t mappingSize)
+    : mFd(fd),
+      mMappingSize(mappingSize),
+      mControl(static_cast<Control*>(mapping)),
+      mData(static_cast<char*>(mapping) + kDataOffset) {
+    mCapacity = mControl->capacity;
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+    munmap(mControl, mMappingSize);
+    close(mFd);
+}
+
+int SharedMemoryRing::GetFd() const {
+    return mFd;
+}
+
+size_t SharedMemoryRing::GetCapacity() const {
+    return mCapacity;
+}
+
+void SharedMemoryRing::Close() {
+    mControl->closed.store(1);
+    Signal(&mControl->headSignal, true);
+    Signal(&mControl->tailSignal, true);
+}
+
+bool SharedMemoryRing::IsClosed() const {
+    return mControl->closed.load() != 0;
+}
+
+SharedMemoryRingSerializer::SharedMemoryRingSerializer(SharedMemoryRing* ring) : mRing(ring) {
+    mWritePos = mRing->mControl->head.load(std::memory_order_relaxed);
+    mCachedTail = mRing->mControl->tail.load(std::memory_order_acquire);
+}
+
+size_t SharedMemoryRingSerializer::GetMaximumAllocationSize() const {
+    // Keep commands small compared to the ring so that the consumer can work on some frames while
+    // the producer fills the rest of the ring. Larger commands are split by the wire.
+    return mRing->mCapacity / 4;
+}
+
+void* SharedMemoryRingSerializer::GetCmdSpace(size_t size) {
+    // Note: This returns non-null even if size is zero.
+    if (size > GetMaximumAllocationSize() || mRing->IsClosed()) {
+        return nullptr;
+    }
+    const uint32_t capacity = mRing->mCapacity;
+    const uint32_t commandSize = static_cast<uint32_t>(size);
+
+    // Fast path: append the command to the current frame if it fits before the end of the ring
+    // and the consumer already released that space.
+    if (mFrameOpen) {
+        // Compute the end of the frame from its start as the frame may end exactly at the end
+        // of the ring.
+        uint32_t frameEnd = (mFrameStart & (capacity - 1)) + (mWritePos - mFrameStart);
+        if (capacity - frameEnd >= commandSize && mWritePos + commandSize - mCachedTail <= capacity) {
+            mWritePos += commandSize;
+            return mRing->mData + frameEnd;
+        }
+        // Publish the current frame before waiting so that the consumer can make progress.
+        if (!Flush()) {
+            return nullptr;
+        }
+    }
+
+    // Start a new frame, wrapping around to the start of the ring if the frame header and the
+    // command can't be contiguous.
+    uint32_t offset = mWritePos & (capacity - 1);
+    uint32_t frameSize = kFrameHeaderSize + commandSize;
+    if (capacity - offset < frameSize) {
+        uint32_t skippedSize = capacity - offset;
+        if (!WaitForSpace(mWritePos + skippedSize)) {
+            return nullptr;
+        }
+        *reinterpret_cast<uint32_t*>(mRing->mData + offset) = kWrapMarker;
+        mWritePos += skippedSize;
+        Publish();
+        offset = 0;
+    }
+    if (!WaitForSpace(mWritePos + frameSize)) {
+        return nullptr;
+    }
+
+    mFrameStart = mWritePos;
+    mFrameOpen = true;
+    mWritePos += frameSize;
+    return mRing->mData + offset + kFrameHeaderSize;
+}
+
+bool SharedMemoryRingSerializer::Flush() {
+    if (!mFrameOpen) {
+        return !mRing->IsClosed();
+    }
+    uint32_t offset = mFrameStart & (mRing->mCapacity - 1);
+    *reinterpret_cast<uint32_t*>(mRing->mData + offset) =
+        mWritePos - mFrameStart - kFrameHeaderSize;
+    mWritePos = AlignFrame(mWritePos);
+    mFrameOpen = false;
+    Publish();
+    return !mRing->IsClosed();
+}
+
+bool SharedMemoryRingSerializer::WaitForSpace(uint32_t end) {
+    SharedMemoryRing::Control* control = mRing->mControl;
+    const uint32_t capacity = mRing->mCapacity;
+    auto HasSpace = [&] {
+        mCachedTail = control->tail.load();
+        return end - mCachedTail <= capacity || mRing->IsClosed();
+    };
+
+    if (end - mCachedTail <= capacity) {
+        return true;
+    }
+    while (!WaitForSignal(&control->tailSignal, kInfiniteTimeout, HasSpace)) {
+    }
+    return !mRing->IsClosed();
+}
+
+void SharedMemoryRingSerializer::Publish() {
+    mRing->mControl->head.store(mWritePos);
+    Signal(&mRing->mControl->headSignal, false);
+}
+
+SharedMemoryRingReceiver::SharedMemoryRingReceiver(SharedMemoryRing* ring) : mRing(ring) {
+    mReadPos = mRing->mControl->tail.load(std::memory_order_relaxed);
+}
+
+bool SharedMemoryRingReceiver::WaitForCommands(uint64_t timeoutNs) {
+    SharedMemoryRing::Control* control = mRing->mControl;
+    return WaitForSignal(&control->headSignal, timeoutNs, [&] {
+        return control->head.load() != mReadPos || mRing->IsClosed();
+    }) && control->head.load(std::memory_order_acquire) != mReadPos;
+}
+
+bool SharedMemoryRingReceiver::ProcessCommands(dawn::wire::CommandHandler* handler) {
+    SharedMemoryRing::Control* control = mRing->mControl;
+    const uint32_t capacity = mRing->mCapacity;
+    const uint32_t head = control->head.load(std::memory_order_acquire);
+    if (head % kFrameAlignment != 0) {
+        return false;
+    }
+
+    bool success = true;
+    while (mReadPos != head) {
+        // The producer may be in another, untrusted, process so validate the frame before using
+        // it and only read its header once.
+        uint32_t offset = mReadPos & (capacity - 1);
+        uint32_t available = head - mReadPos;
+        if (available < kFrameHeaderSize || available > capacity) {
+            return false;
+        }
+        uint32_t payloadSize = *reinterpret_cast<const volatile uint32_t*>(mRing->mData + offset);
+
+        uint32_t frameSize;
+        if (payloadSize == kWrapMarker) {
+            frameSize = capacity - offset;
+        } else {
+            if (payloadSize > capacity - offset - kFrameHeaderSize) {
+                return false;
+            }
+            frameSize = AlignFrame(kFrameHeaderSize + payloadSize);
+            if (frameSize <= available &&
+                handler->HandleCommands(mRing->mData + offset + kFrameHeaderSize, payloadSize) ==
+                    nullptr) {
+                success = false;
+            }
+        }
+        if (frameSize > available) {
+            return false;
+        }
+
+        mReadPos += frameSize;
+        control->tail.store(mReadPos);
+        Signal(&control->tailSignal, false);
+    }
+    return success;
+}
+
+}  // namespace dawn::utils
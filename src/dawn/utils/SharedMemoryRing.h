@@ -0,0 +1,125 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_UTILS_SHAREDMEMORYRING_H_
+#define SRC_DAWN_UTILS_SHAREDMEMORYRING_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "dawn/wire/Wire.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+#include "partition_alloc/pointers/raw_ptr_exclusion.h"
+
+namespace dawn::utils {
+
+// A single-producer single-consumer ring buffer of wire commands that lives in a memfd so that it
+// can be shared between a wire client and a wire server running in different processes. The file
+// descriptor can be inherited through fork() or sent over a socket, then opened with Import().
+//
+// The producer appends commands to a "frame" directly in the shared memory and Flush() publishes
+// the whole frame at once, so the consumer hands each batch of commands to the wire in a single
+// HandleCommands call. Head and tail are lock-free counters; a side that cannot make progress
+// (ring full or ring empty) sleeps on a futex and is only woken if it announced it was waiting.
+class SharedMemoryRing {
+  public:
+    // Creates a new ring with room for |capacity| bytes of frames. |capacity| is rounded up to a
+    // power of two. Returns nullptr on failure.
+    static std::unique_ptr<SharedMemoryRing> Create(size_t capacity);
+    // Maps the ring created by another process. Takes ownership of |fd|. Returns nullptr if the
+    // file does not contain a valid ring.
+    static std::unique_ptr<SharedMemoryRing> Import(int fd);
+
+    ~SharedMemoryRing();
+
+    int GetFd() const;
+    size_t GetCapacity() const;
+
+    // Marks the ring as closed and wakes both sides. Can be called from either side.
+    void Close();
+    bool IsClosed() const;
+
+    // The header at the start of the shared memory, followed by the ring data.
+    struct Control;
+
+  private:
+    friend class SharedMemoryRingSerializer;
+    friend class SharedMemoryRingReceiver;
+
+    SharedMemoryRing(int fd, void* mapping, size_t mappingSize);
+
+    int mFd;
+    size_t mMappingSize;
+    uint32_t mCapacity;
+    // RAW_PTR_EXCLUSION: These point into the mmap-ed shared memory, not into allocator memory.
+    RAW_PTR_EXCLUSION Control* mControl;
+    RAW_PTR_EXCLUSION char* mData;
+};
+
+// The producer side of a SharedMemoryRing, to be used as the serializer of a wire client or
+// server.
+class SharedMemoryRingSerializer : public dawn::wire::CommandSerializer {
+  public:
+    explicit SharedMemoryRingSerializer(SharedMemoryRing* ring);
+
+    size_t GetMaximumAllocationSize() const override;
+    void* GetCmdSpace(size_t size) override;
+    bool Flush() override;
+
+  private:
+    // Waits until the consumer has released enough of the ring that |end| can be written to.
+    bool WaitForSpace(uint32_t end);
+    void Publish();
+
+    raw_ptr<SharedMemoryRing> mRing;
+    uint32_t mWritePos = 0;
+    uint32_t mFrameStart = 0;
+    bool mFrameOpen = false;
+    uint32_t mCachedTail = 0;
+};
+
+// The consumer side of a SharedMemoryRing that forwards the frames to a wire client or server.
+class SharedMemoryRingReceiver {
+  public:
+    explicit SharedMemoryRingReceiver(SharedMemoryRing* ring);
+
+    // Blocks until at least one frame is available, the ring is closed or |timeoutNs|
+    // nanoseconds elapsed. Returns whether frames are available.
+    bool WaitForCommands(uint64_t timeoutNs);
+
+    // Handles all the frames published so far. Returns false if the handler failed or the
+    // ring contents are invalid.
+    bool ProcessCommands(dawn::wire::CommandHandler* handler);
+
+  private:
+    raw_ptr<SharedMemoryRing> mRing;
+    uint32_t mReadPos = 0;
+};
+
+}  // namespace dawn::utils
+
+#endif  // SRC_DAWN_UTILS_SHAREDMEMORYRING_H_
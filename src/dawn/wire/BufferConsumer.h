@@ -29,6 +29,7 @@
 #define SRC_DAWN_WIRE_BUFFERCONSUMER_H_
 
 #include <cstddef>
+#include <vector>
 
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
@@ -78,11 +79,36 @@ class BufferConsumer {
     size_t mSize;
 };
 
+// A span of a serialized command that is left out of the SerializeBuffer and read from the source
+// memory directly when the command is written out. See SerializeBuffer::SetReferences.
+struct SerializeBufferReference {
+    // Position in the SerializeBuffer at which the span is logically inserted.
+    raw_ptr<const char, AllowPtrArithmetic> position;
+    raw_ptr<const void> data;
+    size_t size;
+    // Size taken by the span in the serialized command, including the alignment padding.
+    size_t alignedSize;
+};
+
 class SerializeBuffer : public BufferConsumer<char> {
   public:
     using BufferConsumer::BufferConsumer;
     using BufferConsumer::Next;
     using BufferConsumer::NextN;
+
+    // Serializes |count| wire transparent elements from |data|.
+    template <typename T, typename N>
+    WireResult CopyN(const T* data, N count);
+
+    // When set, CopyN records the spans in |references| instead of copying them into the buffer
+    // and the spans don't take space in the buffer. This lets a command larger than the
+    // transport's maximum allocation be written out in chunks without first copying its payloads.
+    void SetReferences(std::vector<SerializeBufferReference>* references) {
+        mReferences = references;
+    }
+
+  private:
+    raw_ptr<std::vector<SerializeBufferReference>> mReferences = nullptr;
 };
 
 class DeserializeBuffer : public BufferConsumer<const volatile char> {
@@ -28,6 +28,7 @@
 #ifndef SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
 #define SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
 
+#include <cstring>
 #include <limits>
 #include <type_traits>
 
@@ -77,6 +78,32 @@ WireResult BufferConsumer<BufferT>::NextN(N count, T** data) {
     return WireResult::Success;
 }
 
+template <typename T, typename N>
+WireResult SerializeBuffer::CopyN(const T* data, N count) {
+    static_assert(std::is_unsigned<N>::value, "|count| argument of CopyN must be unsigned.");
+
+    if (mReferences != nullptr) {
+        auto size = WireAlignSizeofN<T>(count);
+        if (!size) {
+            return WireResult::FatalError;
+        }
+        if (count != 0) {
+            mReferences->push_back({Buffer(), data, sizeof(T) * count, *size});
+        }
+        return WireResult::Success;
+    }
+
+    T* dst;
+    WIRE_TRY(NextN(count, &dst));
+    // memcpy is not defined for null pointers, even when the length is zero. This conflicts with
+    // the common practice to use (nullptr, 0) to represent a span. Guard memcpy with a zero check
+    // to work around this language bug.
+    if (count != 0) {
+        memcpy(dst, data, sizeof(T) * count);
+    }
+    return WireResult::Success;
+}
+
 }  // namespace dawn::wire
 
 #endif  // SRC_DAWN_WIRE_BUFFERCONSUMER_IMPL_H_
@@ -32,6 +32,7 @@
 #include <utility>
 
 #include "dawn/common/Alloc.h"
+#include "dawn/common/Constants.h"
 
 namespace dawn::wire {
 
@@ -59,8 +60,14 @@ const volatile char* ChunkedCommandHandler::HandleCommands(const volatile char*
         if (mChunkedCommandRemainingSize == 0) {
             // Once the chunked command is complete, pass the data to the command handler
             // implemenation.
-            auto chunkedCommandData = std::move(mChunkedCommandData);
-            if (HandleCommandsImpl(chunkedCommandData.get(), mChunkedCommandPutOffset) == nullptr) {
+            mChunkedCommandInFlight = false;
+            const volatile char* result =
+                HandleCommandsImpl(mChunkedCommandData.get(), mChunkedCommandPutOffset);
+            if (mChunkedCommandDataSize > kMaxRetainedWireChunkedCommandSize) {
+                mChunkedCommandData.reset();
+                mChunkedCommandDataSize = 0;
+            }
+            if (result == nullptr) {
                 // |HandleCommandsImpl| returns nullptr on error. Forward any errors
                 // out.
                 return nullptr;
@@ -75,14 +82,18 @@ ChunkedCommandHandler::ChunkedCommandsResult ChunkedCommandHandler::BeginChunked
     const volatile char* commands,
     size_t commandSize,
     size_t initialSize) {
-    DAWN_ASSERT(!mChunkedCommandData);
+    DAWN_ASSERT(!mChunkedCommandInFlight);
 
     // Reserve space for all the command data we're expecting, and copy the initial data
     // to the start of the memory.
-    mChunkedCommandData.reset(AllocNoThrow<char>(commandSize));
-    if (!mChunkedCommandData) {
-        return ChunkedCommandsResult::Error;
+    if (commandSize > mChunkedCommandDataSize) {
+        mChunkedCommandData.reset(AllocNoThrow<char>(commandSize));
+        mChunkedCommandDataSize = mChunkedCommandData ? commandSize : 0;
+        if (!mChunkedCommandData) {
+            return ChunkedCommandsResult::Error;
+        }
     }
+    mChunkedCommandInFlight = true;
 
     memcpy(mChunkedCommandData.get(), const_cast<const char*>(commands), initialSize);
     mChunkedCommandPutOffset = initialSize;
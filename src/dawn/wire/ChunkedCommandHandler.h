@@ -77,7 +77,12 @@ class ChunkedCommandHandler : public CommandHandler {
 
     size_t mChunkedCommandRemainingSize = 0;
     size_t mChunkedCommandPutOffset = 0;
+    // Reassembly buffer for the in-flight chunked command. It is kept after the command is handled
+    // so that the next chunked command can reuse it, unless it is larger than
+    // kMaxRetainedWireChunkedCommandSize.
     std::unique_ptr<char[]> mChunkedCommandData;
+    size_t mChunkedCommandDataSize = 0;
+    bool mChunkedCommandInFlight = false;
 };
 
 }  // namespace dawn::wire
@@ -27,23 +27,98 @@
 
 #include "dawn/wire/ChunkedCommandSerializer.h"
 
+#include "dawn/common/Assert.h"
+
 namespace dawn::wire {
 
 ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer)
     : mSerializer(serializer), mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {}
 
-void ChunkedCommandSerializer::SerializeChunkedCommand(const char* allocatedBuffer,
-                                                       size_t remainingSize) {
-    while (remainingSize > 0) {
-        size_t chunkSize = std::min(remainingSize, mMaxAllocationSize);
-        void* dst = mSerializer->GetCmdSpace(chunkSize);
-        if (dst == nullptr) {
+namespace {
+
+// Copies the pieces of a chunked command into successive allocations of the serializer.
+class ChunkWriter {
+  public:
+    ChunkWriter(CommandSerializer* serializer, size_t commandSize, size_t maxChunkSize)
+        : mSerializer(serializer), mUnallocatedSize(commandSize), mMaxChunkSize(maxChunkSize) {}
+
+    // Writes |size| bytes of |data|, or |size| zero bytes if |data| is nullptr. Returns false if
+    // the serializer failed to allocate space.
+    bool Write(const char* data, size_t size) {
+        while (size > 0) {
+            if (mChunkSize == 0) {
+                DAWN_ASSERT(mUnallocatedSize > 0);
+                size_t chunkSize = std::min(mUnallocatedSize, mMaxChunkSize);
+                mChunk = static_cast<char*>(mSerializer->GetCmdSpace(chunkSize));
+                if (mChunk == nullptr) {
+                    return false;
+                }
+                mChunkSize = chunkSize;
+                mUnallocatedSize -= chunkSize;
+            }
+
+            size_t copySize = std::min(size, mChunkSize);
+            if (data != nullptr) {
+                memcpy(mChunk, data, copySize);
+                data += copySize;
+            } else {
+                memset(mChunk, 0, copySize);
+            }
+            mChunk += copySize;
+            mChunkSize -= copySize;
+            size -= copySize;
+        }
+        return true;
+    }
+
+  private:
+    raw_ptr<CommandSerializer> mSerializer;
+    size_t mUnallocatedSize;
+    size_t mMaxChunkSize;
+    raw_ptr<char, AllowPtrArithmetic> mChunk = nullptr;
+    size_t mChunkSize = 0;
+};
+
+}  // anonymous namespace
+
+void ChunkedCommandSerializer::SerializeChunkedCommand(const char* stagingBuffer,
+                                                       size_t stagedSize,
+                                                       size_t commandSize) {
+    size_t totalSize = stagedSize;
+    for (const SerializeBufferReference& reference : mReferences) {
+        totalSize += reference.alignedSize;
+    }
+    if (DAWN_UNLIKELY(totalSize != commandSize)) {
+        mSerializer->OnSerializeError();
+        return;
+    }
+
+    ChunkWriter writer(mSerializer, commandSize, mMaxAllocationSize);
+    const char* staged = stagingBuffer;
+    for (const SerializeBufferReference& reference : mReferences) {
+        const char* position = reference.position.get();
+        if (!writer.Write(staged, position - staged) ||
+            !writer.Write(static_cast<const char*>(reference.data.get()), reference.size) ||
+            !writer.Write(nullptr, reference.alignedSize - reference.size)) {
             return;
         }
-        memcpy(dst, allocatedBuffer, chunkSize);
+        staged = position;
+    }
+    writer.Write(staged, stagingBuffer + stagedSize - staged);
+}
+
+char* ChunkedCommandSerializer::AcquireStagingBuffer(size_t size) {
+    if (size > mStagingBufferSize) {
+        mStagingBuffer.reset(AllocNoThrow<char>(size));
+        mStagingBufferSize = mStagingBuffer ? size : 0;
+    }
+    return mStagingBuffer.get();
+}
 
-        allocatedBuffer += chunkSize;
-        remainingSize -= chunkSize;
+void ChunkedCommandSerializer::ReleaseStagingBuffer() {
+    if (mStagingBufferSize > kMaxRetainedWireChunkedCommandSize) {
+        mStagingBuffer.reset();
+        mStagingBufferSize = 0;
     }
 }
 
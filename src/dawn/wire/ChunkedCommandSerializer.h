@@ -33,6 +33,7 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "dawn/common/Alloc.h"
 #include "dawn/common/Compiler.h"
@@ -128,24 +129,59 @@ class ChunkedCommandSerializer {
             return;
         }
 
-        auto cmdSpace = std::unique_ptr<char[]>(AllocNoThrow<char>(requiredSize));
-        if (!cmdSpace) {
+        // The command doesn't fit in a single allocation so it is written out in chunks. First try
+        // staging only the parts of the command that aren't payloads like WriteBuffer's data, and
+        // copy the payloads straight from their source memory into the chunks. If the rest of the
+        // command is too large for that, stage the whole command instead.
+        mReferences.clear();
+        size_t stagingSize = std::min(std::min(requiredSize, mMaxAllocationSize),
+                                      kMaxRetainedWireChunkedCommandSize);
+        char* cmdSpace = AcquireStagingBuffer(stagingSize);
+        if (cmdSpace == nullptr) {
             return;
         }
-        SerializeBuffer serializeBuffer(cmdSpace.get(), requiredSize);
-        WireResult rCmd = SerializeCmd(cmd, requiredSize, &serializeBuffer);
-        WireResult rExts = detail::SerializeCommandExtension(&serializeBuffer, extensions...);
-        if (DAWN_UNLIKELY(rCmd != WireResult::Success || rExts != WireResult::Success)) {
-            mSerializer->OnSerializeError();
-            return;
+        SerializeBuffer serializeBuffer(cmdSpace, stagingSize);
+        serializeBuffer.SetReferences(&mReferences);
+        if (SerializeCmd(cmd, requiredSize, &serializeBuffer) != WireResult::Success ||
+            detail::SerializeCommandExtension(&serializeBuffer, extensions...) !=
+                WireResult::Success) {
+            mReferences.clear();
+            stagingSize = requiredSize;
+            cmdSpace = AcquireStagingBuffer(stagingSize);
+            if (cmdSpace == nullptr) {
+                return;
+            }
+            serializeBuffer = SerializeBuffer(cmdSpace, stagingSize);
+            WireResult rCmd = SerializeCmd(cmd, requiredSize, &serializeBuffer);
+            WireResult rExts = detail::SerializeCommandExtension(&serializeBuffer, extensions...);
+            if (DAWN_UNLIKELY(rCmd != WireResult::Success || rExts != WireResult::Success)) {
+                mSerializer->OnSerializeError();
+                ReleaseStagingBuffer();
+                return;
+            }
         }
-        SerializeChunkedCommand(cmdSpace.get(), requiredSize);
+        SerializeChunkedCommand(cmdSpace, stagingSize - serializeBuffer.AvailableSize(),
+                                requiredSize);
+        ReleaseStagingBuffer();
     }
 
-    void SerializeChunkedCommand(const char* allocatedBuffer, size_t remainingSize);
+    // Writes the |stagedSize| bytes of |stagingBuffer|, interleaved with the spans in
+    // |mReferences|, in chunks of at most |mMaxAllocationSize| bytes. |commandSize| is the total
+    // size of the command.
+    void SerializeChunkedCommand(const char* stagingBuffer, size_t stagedSize, size_t commandSize);
+
+    // Returns a buffer of at least |size| bytes to serialize a command that is too large for the
+    // serializer, or nullptr on allocation failure. The buffer is reused across commands so that
+    // upload-heavy clients don't allocate, fault in and free a new one for every large command.
+    char* AcquireStagingBuffer(size_t size);
+    void ReleaseStagingBuffer();
 
     raw_ptr<CommandSerializer> mSerializer;
     size_t mMaxAllocationSize;
+
+    std::unique_ptr<char[]> mStagingBuffer;
+    size_t mStagingBufferSize = 0;
+    std::vector<SerializeBufferReference> mReferences;
 };
 
 }  // namespace dawn::wire
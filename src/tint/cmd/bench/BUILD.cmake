@@ -54,6 +54,7 @@ tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
   tint_lang_wgsl_sem
   tint_lang_wgsl_bench
   tint_utils_containers
+  tint_utils_containers_bench
   tint_utils_diagnostic
   tint_utils_ice
   tint_utils_id
@@ -100,6 +101,7 @@ endif(TINT_BUILD_SPV_WRITER)
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_bench_cmd bench_cmd
     tint_lang_wgsl_reader_bench
+    tint_lang_wgsl_resolver_bench
   )
 endif(TINT_BUILD_WGSL_READER)
 
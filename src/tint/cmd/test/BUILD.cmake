@@ -192,6 +192,7 @@ endif(TINT_BUILD_TINTD AND TINT_BUILD_WGSL_READER)
 
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_test_test_cmd test_cmd
+    tint_lang_core_ir_interpreter_test
     tint_lang_wgsl_inspector_test
     tint_lang_wgsl_reader_parser_test
     tint_lang_wgsl_reader_program_to_ir_test
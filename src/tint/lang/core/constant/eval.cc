@@ -504,6 +504,18 @@ TransformElements(Manager& mgr,
     return mgr.Composite(composite_ty, std::move(els));
 }
 
+/// SplatElement returns a splat of type `composite_ty` holding the transformed element `el`, or the
+/// failure of `el`.
+/// The element-wise transforms below use this when every operand is a splat (or a scalar that is
+/// broadcast). All the elements of such operands are identical, so a single element is evaluated
+/// instead of one per element, and no per-element Composite is built and hashed.
+Eval::Result SplatElement(Manager& mgr, const core::type::Type* composite_ty, Eval::Result el) {
+    if (el != Success) {
+        return el.Failure();
+    }
+    return mgr.Splat(composite_ty, el.Get());
+}
+
 /// Signature of a unary transformation callback
 using UnaryTransform = std::function<Eval::Result(const Value*)>;
 
@@ -520,6 +532,11 @@ Eval::Result TransformUnaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (auto* splat = c0->As<Splat>()) {
+        return SplatElement(mgr, composite_ty,
+                            TransformUnaryElements(mgr, composite_el_ty, f, splat->el));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -552,6 +569,12 @@ Eval::Result TransformBinaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (c0->Is<Splat>() && c1->Is<Splat>()) {
+        return SplatElement(
+            mgr, composite_ty,
+            TransformBinaryElements(mgr, composite_el_ty, f, c0->Index(0), c1->Index(0)));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
@@ -584,6 +607,19 @@ Eval::Result TransformBinaryDifferingArityElements(Manager& mgr,
 
     const auto* element_ty = composite_ty->Elements(composite_ty).type;
 
+    // A scalar operand is broadcast to every element, so it behaves like a splat.
+    auto is_uniform = [](const Value* c, uint32_t num_elems) {
+        return num_elems == 1 || c->Is<Splat>();
+    };
+    if (is_uniform(c0, n0) && is_uniform(c1, n1)) {
+        auto element = [](const Value* c, uint32_t num_elems) {
+            return (num_elems == 1) ? c : c->Index(0);
+        };
+        auto el = TransformBinaryDifferingArityElements(mgr, element_ty, f, element(c0, n0),
+                                                        element(c1, n1));
+        return SplatElement(mgr, composite_ty, std::move(el));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(max_n);
     for (uint32_t i = 0; i < max_n; i++) {
@@ -620,6 +656,12 @@ Eval::Result TransformTernaryElements(Manager& mgr,
 
     auto* composite_el_ty = composite_ty->Elements(composite_ty).type;
 
+    if (c0->Is<Splat>() && c1->Is<Splat>() && c2->Is<Splat>()) {
+        return SplatElement(mgr, composite_ty,
+                            TransformTernaryElements(mgr, composite_el_ty, f, c0->Index(0),
+                                                     c1->Index(0), c2->Index(0)));
+    }
+
     Vector<const Value*, 8> els;
     els.Reserve(n);
     for (uint32_t i = 0; i < n; i++) {
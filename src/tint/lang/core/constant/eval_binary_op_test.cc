@@ -27,6 +27,7 @@
 
 #include "src/tint/lang/core/constant/eval_test.h"
 
+#include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/wgsl/builtin_fn.h"
 #include "src/tint/utils/result/result.h"
 
@@ -1217,6 +1218,41 @@ TEST_F(ConstEvalTest, BinaryAbstractShiftLeftRemainsAbstract) {
     EXPECT_EQ(sem2->Type(), aint_ty);
 }
 
+// Element-wise operations on splats evaluate a single element and produce a splat
+TEST_F(ConstEvalTest, BinarySplatOperandsRemainSplat) {
+    auto* vec_vec = Mul(Call<vec4<f32>>(2_f), Call<vec4<f32>>(3_f));
+    GlobalConst("c1", vec_vec);
+
+    auto* scalar_mat = Mul(2_f, Call<mat3x3<f32>>(Call<vec3<f32>>(1.5_f), Call<vec3<f32>>(1.5_f),
+                                                  Call<vec3<f32>>(1.5_f)));
+    GlobalConst("c2", scalar_mat);
+
+    EXPECT_TRUE(r()->Resolve()) << r()->error();
+
+    auto* sem1 = Sem().Get(vec_vec);
+    ASSERT_NE(sem1, nullptr);
+    ASSERT_TRUE(sem1->ConstantValue()->Is<constant::Splat>());
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(sem1->ConstantValue()->Index(i)->ValueAs<f32>(), 6_f);
+    }
+
+    auto* sem2 = Sem().Get(scalar_mat);
+    ASSERT_NE(sem2, nullptr);
+    ASSERT_TRUE(sem2->ConstantValue()->Is<constant::Splat>());
+    auto* column = sem2->ConstantValue()->Index(2);
+    ASSERT_TRUE(column->Is<constant::Splat>());
+    EXPECT_EQ(column->Index(1)->ValueAs<f32>(), 3_f);
+}
+
+TEST_F(ConstEvalTest, BinarySplatOperandsOverflow) {
+    GlobalConst("c", Mul(Source{{1, 1}}, Call<vec4<f32>>(Expr(f32::Highest())),
+                         Call<vec4<f32>>(2_f)));
+    EXPECT_FALSE(r()->Resolve());
+    EXPECT_EQ(r()->error(),
+              "1:1 error: '340282346638528859811704183484516925440.0 * 2.0' cannot be "
+              "represented as 'f32'");
+}
+
 // i32/u32 left shift by >= 32 -> error
 using ConstEvalShiftLeftConcreteGeqBitWidthError = ConstEvalTestWithParam<ErrorCase>;
 TEST_P(ConstEvalShiftLeftConcreteGeqBitWidthError, Test) {
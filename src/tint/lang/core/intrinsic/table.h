@@ -39,6 +39,7 @@
 #include "src/tint/lang/core/intrinsic/table_data.h"
 #include "src/tint/lang/core/parameter_usage.h"
 #include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/text/string.h"
 #include "src/tint/utils/text/string_stream.h"
@@ -247,6 +248,8 @@ Result<Overload, StyledText> LookupCtorConv(Context& context,
                                             EvaluationStage earliest_eval_stage);
 
 /// Table is a wrapper around a dialect to provide type-safe interface to the intrinsic table.
+/// Successful lookups are memoized, so repeated lookups with the same signature return the
+/// previously resolved overload without re-running overload resolution.
 template <typename DIALECT>
 struct Table {
     /// Alias to DIALECT::BuiltinFn
@@ -279,10 +282,13 @@ struct Table {
                                         VectorRef<const core::type::Type*> template_args,
                                         VectorRef<const core::type::Type*> args,
                                         EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(builtin_fn);
         size_t id = static_cast<size_t>(builtin_fn);
-        return LookupFn(context, name, id, std::move(template_args), std::move(args),
-                        earliest_eval_stage);
+        return Memoize(CacheKey(LookupKind::kFn, id, earliest_eval_stage, template_args, args),
+                       [&] {
+                           std::string_view name = DIALECT::ToString(builtin_fn);
+                           return LookupFn(context, name, id, template_args, args,
+                                           earliest_eval_stage);
+                       });
     }
 
     /// Lookup looks for the member builtin overload with the given signature, raising an error
@@ -308,10 +314,14 @@ struct Table {
         for (auto* arg : args) {
             full_args.Push(arg);
         }
-        std::string_view name = DIALECT::ToString(builtin_fn);
         size_t id = static_cast<size_t>(builtin_fn);
-        return LookupMemberFn(context, name, id, std::move(template_args), std::move(full_args),
-                              earliest_eval_stage);
+        return Memoize(
+            CacheKey(LookupKind::kMemberFn, id, earliest_eval_stage, template_args, full_args),
+            [&] {
+                std::string_view name = DIALECT::ToString(builtin_fn);
+                return LookupMemberFn(context, name, id, template_args, full_args,
+                                      earliest_eval_stage);
+            });
     }
 
     /// Lookup looks for the unary op overload with the given signature, raising an error
@@ -329,7 +339,10 @@ struct Table {
     Result<Overload, StyledText> Lookup(core::UnaryOp op,
                                         const core::type::Type* arg,
                                         EvaluationStage earliest_eval_stage) {
-        return LookupUnary(context, op, arg, earliest_eval_stage);
+        Vector<const core::type::Type*, 1> args{arg};
+        return Memoize(CacheKey(LookupKind::kUnary, static_cast<size_t>(op), earliest_eval_stage,
+                                Empty, args),
+                       [&] { return LookupUnary(context, op, arg, earliest_eval_stage); });
     }
 
     /// Lookup looks for the binary op overload with the given signature, raising an error
@@ -351,7 +364,13 @@ struct Table {
                                         const core::type::Type* rhs,
                                         EvaluationStage earliest_eval_stage,
                                         bool is_compound) {
-        return LookupBinary(context, op, lhs, rhs, earliest_eval_stage, is_compound);
+        Vector<const core::type::Type*, 2> args{lhs, rhs};
+        auto kind = is_compound ? LookupKind::kCompoundBinary : LookupKind::kBinary;
+        return Memoize(CacheKey(kind, static_cast<size_t>(op), earliest_eval_stage, Empty, args),
+                       [&] {
+                           return LookupBinary(context, op, lhs, rhs, earliest_eval_stage,
+                                               is_compound);
+                       });
     }
 
     /// Lookup looks for the value constructor or conversion overload for the given CtorConv.
@@ -369,14 +388,114 @@ struct Table {
                                         VectorRef<const core::type::Type*> template_args,
                                         VectorRef<const core::type::Type*> args,
                                         EvaluationStage earliest_eval_stage) {
-        std::string_view name = DIALECT::ToString(type);
         size_t id = static_cast<size_t>(type);
-        return LookupCtorConv(context, name, id, std::move(template_args), std::move(args),
-                              earliest_eval_stage);
+        return Memoize(
+            CacheKey(LookupKind::kCtorConv, id, earliest_eval_stage, template_args, args), [&] {
+                std::string_view name = DIALECT::ToString(type);
+                return LookupCtorConv(context, name, id, template_args, args,
+                                      earliest_eval_stage);
+            });
     }
 
     /// The intrinsic context
     Context context;
+
+    /// CacheStats holds the hit and miss counts of the lookup cache
+    struct CacheStats {
+        /// Number of lookups that were served from the cache
+        size_t hits = 0;
+        /// Number of lookups that ran overload resolution
+        size_t misses = 0;
+    };
+
+    /// The lookup cache statistics
+    CacheStats cache_stats;
+
+  private:
+    /// LookupKind is the kind of intrinsic being looked up
+    enum class LookupKind : uint8_t {
+        kFn,
+        kMemberFn,
+        kUnary,
+        kBinary,
+        kCompoundBinary,
+        kCtorConv,
+    };
+
+    /// CacheKey is the key of the lookup cache. It holds all the inputs of a lookup.
+    struct CacheKey {
+        /// Constructor
+        /// @param k the lookup kind
+        /// @param i the builtin, operator or type identifier
+        /// @param s the earliest evaluation stage
+        /// @param template_args the template arguments
+        /// @param args the argument types
+        CacheKey(LookupKind k,
+                 size_t i,
+                 EvaluationStage s,
+                 VectorRef<const core::type::Type*> template_args,
+                 VectorRef<const core::type::Type*> args)
+            : kind(k), id(i), stage(s), num_template_args(template_args.Length()) {
+            types.Reserve(template_args.Length() + args.Length());
+            for (auto* ty : template_args) {
+                types.Push(ty);
+            }
+            for (auto* ty : args) {
+                types.Push(ty);
+            }
+        }
+
+        /// @returns the hash code of the key
+        tint::HashCode HashCode() const {
+            auto hash = Hash(kind, id, stage, num_template_args, types.Length());
+            for (auto* ty : types) {
+                hash = HashCombine(hash, ty);
+            }
+            return hash;
+        }
+
+        /// Equality operator
+        /// @param other the key to compare against
+        /// @returns true if this key and @p other are the same
+        bool operator==(const CacheKey& other) const {
+            return kind == other.kind && id == other.id && stage == other.stage &&
+                   num_template_args == other.num_template_args && types == other.types;
+        }
+
+        /// The lookup kind
+        LookupKind kind;
+        /// The builtin, operator or type identifier
+        size_t id;
+        /// The earliest evaluation stage
+        EvaluationStage stage;
+        /// The number of template arguments at the front of #types
+        size_t num_template_args;
+        /// The template arguments followed by the argument types
+        Vector<const core::type::Type*, 8> types;
+    };
+
+    /// Memoize returns the cached overload for @p key, or calls @p lookup and caches the overload
+    /// if the lookup succeeded. Failed lookups are not cached, so that each one still produces
+    /// its diagnostic.
+    /// @param key the cache key
+    /// @param lookup the function that performs the uncached lookup
+    /// @returns the resolved overload
+    template <typename LOOKUP>
+    Result<Overload, StyledText> Memoize(CacheKey&& key, LOOKUP&& lookup) {
+        if (auto cached = cache_.Get(key)) {
+            cache_stats.hits++;
+            return *cached;
+        }
+        cache_stats.misses++;
+        auto result = lookup();
+        if (result == Success) {
+            cache_.Add(std::move(key), result.Get());
+        }
+        return result;
+    }
+
+    /// The lookup cache
+    Hashmap<CacheKey, Overload, 64> cache_;
 };
 
 }  // namespace tint::core::intrinsic
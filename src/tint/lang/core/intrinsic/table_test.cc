@@ -964,5 +964,65 @@ TEST_F(CoreIntrinsicTableTest, MemberFunctionDoesNotMatchNonMemberFunction) {
 )");
 }
 
+TEST_F(CoreIntrinsicTableTest, LookupCache_Hit) {
+    auto* f32 = create<type::F32>();
+    auto a = table.Lookup(BuiltinFn::kCos, Empty, Vector{f32}, EvaluationStage::kConstant);
+    ASSERT_EQ(a, Success);
+    EXPECT_EQ(table.cache_stats.hits, 0u);
+    EXPECT_EQ(table.cache_stats.misses, 1u);
+
+    auto b = table.Lookup(BuiltinFn::kCos, Empty, Vector{f32}, EvaluationStage::kConstant);
+    ASSERT_EQ(b, Success);
+    EXPECT_EQ(table.cache_stats.hits, 1u);
+    EXPECT_EQ(table.cache_stats.misses, 1u);
+    EXPECT_EQ(a.Get(), b.Get());
+    EXPECT_EQ(a->const_eval_fn, b->const_eval_fn);
+}
+
+TEST_F(CoreIntrinsicTableTest, LookupCache_FailureNotCached) {
+    auto* i32 = create<type::I32>();
+    for (int i = 0; i < 2; i++) {
+        auto result = table.Lookup(BuiltinFn::kCos, Empty, Vector{i32}, EvaluationStage::kConstant);
+        ASSERT_NE(result, Success);
+        ASSERT_THAT(result.Failure().Plain(), HasSubstr("no matching call"));
+    }
+    EXPECT_EQ(table.cache_stats.hits, 0u);
+    EXPECT_EQ(table.cache_stats.misses, 2u);
+}
+
+TEST_F(CoreIntrinsicTableTest, LookupCache_KeyedOnEvaluationStage) {
+    auto* i32 = create<type::I32>();
+    auto constant = table.Lookup(UnaryOp::kNegation, i32, EvaluationStage::kConstant);
+    ASSERT_EQ(constant, Success);
+    auto runtime = table.Lookup(UnaryOp::kNegation, i32, EvaluationStage::kRuntime);
+    ASSERT_EQ(runtime, Success);
+    EXPECT_EQ(table.cache_stats.hits, 0u);
+    EXPECT_EQ(table.cache_stats.misses, 2u);
+
+    auto again = table.Lookup(UnaryOp::kNegation, i32, EvaluationStage::kRuntime);
+    ASSERT_EQ(again, Success);
+    EXPECT_EQ(table.cache_stats.hits, 1u);
+    EXPECT_EQ(again->return_type, i32);
+}
+
+TEST_F(CoreIntrinsicTableTest, LookupCache_KeyedOnCompound) {
+    auto* i32 = create<type::I32>();
+    auto* vec3i = create<type::Vector>(i32, 3u);
+    auto binary = table.Lookup(BinaryOp::kMultiply, vec3i, i32, EvaluationStage::kConstant,
+                               /* is_compound */ false);
+    ASSERT_EQ(binary, Success);
+    auto compound = table.Lookup(BinaryOp::kMultiply, vec3i, i32, EvaluationStage::kConstant,
+                                 /* is_compound */ true);
+    ASSERT_EQ(compound, Success);
+    EXPECT_EQ(table.cache_stats.hits, 0u);
+    EXPECT_EQ(table.cache_stats.misses, 2u);
+
+    auto again = table.Lookup(BinaryOp::kMultiply, vec3i, i32, EvaluationStage::kConstant,
+                              /* is_compound */ true);
+    ASSERT_EQ(again, Success);
+    EXPECT_EQ(table.cache_stats.hits, 1u);
+    EXPECT_EQ(again.Get(), compound.Get());
+}
+
 }  // namespace
 }  // namespace tint::core::intrinsic
@@ -0,0 +1,1264 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/interpreter/interpreter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/tint/lang/core/constant/eval.h"
+#include "src/tint/lang/core/constant/manager.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/constant/value.h"
+#include "src/tint/lang/core/intrinsic/table.h"
+#include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/bitcast.h"
+#include "src/tint/lang/core/ir/block_param.h"
+#include "src/tint/lang/core/ir/break_if.h"
+#include "src/tint/lang/core/ir/constant.h"
+#include "src/tint/lang/core/ir/construct.h"
+#include "src/tint/lang/core/ir/continue.h"
+#include "src/tint/lang/core/ir/convert.h"
+#include "src/tint/lang/core/ir/core_binary.h"
+#include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/core_unary.h"
+#include "src/tint/lang/core/ir/exit_if.h"
+#include "src/tint/lang/core/ir/exit_loop.h"
+#include "src/tint/lang/core/ir/exit_switch.h"
+#include "src/tint/lang/core/ir/function.h"
+#include "src/tint/lang/core/ir/function_param.h"
+#include "src/tint/lang/core/ir/if.h"
+#include "src/tint/lang/core/ir/let.h"
+#include "src/tint/lang/core/ir/load.h"
+#include "src/tint/lang/core/ir/load_vector_element.h"
+#include "src/tint/lang/core/ir/loop.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/multi_in_block.h"
+#include "src/tint/lang/core/ir/next_iteration.h"
+#include "src/tint/lang/core/ir/return.h"
+#include "src/tint/lang/core/ir/store.h"
+#include "src/tint/lang/core/ir/store_vector_element.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/ir/swizzle.h"
+#include "src/tint/lang/core/ir/user_call.h"
+#include "src/tint/lang/core/ir/var.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/atomic.h"
+#include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/f16.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/i32.h"
+#include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/pointer.h"
+#include "src/tint/lang/core/type/struct.h"
+#include "src/tint/lang/core/type/u32.h"
+#include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/diagnostic/diagnostic.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/rtti/switch.h"
+
+using namespace tint::core::number_suffixes;  // NOLINT
+
+namespace tint::core::ir::interpreter {
+namespace {
+
+/// A pointer during execution: the memory the pointee lives in and the byte offset of the pointee.
+struct Pointer {
+    Slice<uint8_t> memory;
+    uint64_t offset = 0;
+};
+
+/// The value of an IR value during the execution of an invocation. Non-pointer values are
+/// constant::Values, pointers are Pointers.
+struct RuntimeValue {
+    const constant::Value* value = nullptr;
+    Pointer pointer;
+};
+
+/// The constant evaluation functions of the binary, unary and builtin instructions of a module
+using EvalFns = Hashmap<const Instruction*, constant::Eval::Function, 64>;
+
+/// @returns true if @p inst is a call to a builtin that synchronizes the invocations of the
+/// workgroup.
+bool IsBarrier(const Instruction* inst) {
+    auto* call = inst->As<CoreBuiltinCall>();
+    return call && (call->Func() == BuiltinFn::kWorkgroupBarrier ||
+                    call->Func() == BuiltinFn::kStorageBarrier ||
+                    call->Func() == BuiltinFn::kTextureBarrier);
+}
+
+/// @returns true if @p block calls a builtin that synchronizes the invocations of the workgroup,
+/// directly or through another function.
+bool UsesBarriers(const Block* block, Hashset<const Function*, 8>& visited) {
+    for (auto* inst : *block) {
+        if (IsBarrier(inst)) {
+            return true;
+        }
+        bool uses_barriers = tint::Switch(
+            inst,  //
+            [&](const UserCall* call) {
+                return visited.Add(call->Target()) &&
+                       UsesBarriers(call->Target()->Block(), visited);
+            },
+            [&](const ControlInstruction* ctrl) {
+                bool found = false;
+                ctrl->ForeachBlock(
+                    [&](const Block* b) { found = found || UsesBarriers(b, visited); });
+                return found;
+            },
+            [&](Default) { return false; });
+        if (uses_barriers) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Read-only state shared by all the invocations of a dispatch.
+struct DispatchState {
+    /// Constructor
+    /// @param m the module being run
+    /// @param fns the constant evaluation functions of the instructions of @p m
+    DispatchState(const Module& m, const EvalFns& fns) : mod(m), eval_fns(fns) {}
+
+    /// The module being run
+    const Module& mod;
+    /// The constant evaluation functions of the binary, unary and builtin instructions
+    const EvalFns& eval_fns;
+    /// The entry point
+    const Function* entry_point = nullptr;
+    /// The workgroup size of the entry point
+    std::array<uint32_t, 3> workgroup_size{};
+    /// The number of workgroups of the dispatch
+    std::array<uint32_t, 3> num_workgroups{};
+    /// The memory bound to the buffer variables
+    Hashmap<const Var*, Slice<uint8_t>, 8> buffers;
+    /// True if the invocations of a workgroup need to be interleaved at barriers
+    bool use_barriers = false;
+    /// Serializes atomic operations across all invocations
+    mutable std::mutex atomic_mutex;
+};
+
+/// State shared by the invocations of a single workgroup.
+struct WorkgroupState {
+    /// The workgroup id
+    std::array<uint32_t, 3> id{};
+    /// The memory of the workgroup variables
+    Hashmap<const Var*, std::vector<uint8_t>, 8> memory;
+};
+
+/// Invocation runs a single invocation of the entry point.
+///
+/// The blocks being run are kept on an explicit stack instead of the native one, so that the
+/// invocation can be suspended at a barrier and resumed once the other invocations of the
+/// workgroup have reached it, without a thread per invocation.
+class Invocation {
+  public:
+    /// The status of the invocation after a call to Resume()
+    enum class Status {
+        /// The invocation returned from the entry point
+        kFinished,
+        /// The invocation reached a barrier. It continues after the barrier when resumed.
+        kBarrier,
+        /// The invocation failed, Error() describes the failure
+        kFailed,
+    };
+
+    Invocation(const DispatchState& dispatch,
+               WorkgroupState& workgroup,
+               constant::Manager& constants,
+               std::array<uint32_t, 3> local_id)
+        : dispatch_(dispatch),
+          workgroup_(workgroup),
+          constants_(constants),
+          eval_(constants, diagnostics_, /* use_runtime_semantics */ true),
+          local_id_(local_id) {}
+
+    /// Prepares the invocation to run the entry point from its start.
+    /// @returns true on success, otherwise Error() describes the failure.
+    bool Start() {
+        if (!BindModuleScopeVars() || !BindEntryPointParams()) {
+            return false;
+        }
+        Enter(dispatch_.entry_point->Block(), nullptr);
+        return true;
+    }
+
+    /// Runs the invocation until it returns from the entry point, reaches a barrier or fails.
+    /// @returns the status of the invocation
+    Status Resume() {
+        while (!frames_.IsEmpty()) {
+            Frame& frame = frames_.Back();
+            const Instruction* inst = frame.next;
+            if (!inst) {
+                if (!Exit(nullptr)) {
+                    return Status::kFailed;
+                }
+                continue;
+            }
+            frame.next = inst->next.Get();
+            if (auto* terminator = inst->As<Terminator>()) {
+                if (!Exit(terminator)) {
+                    return Status::kFailed;
+                }
+                continue;
+            }
+            if (IsBarrier(inst)) {
+                return Status::kBarrier;
+            }
+            if (!Exec(inst)) {
+                return Status::kFailed;
+            }
+        }
+        return Status::kFinished;
+    }
+
+    /// Runs the whole invocation, passing through barriers.
+    /// @returns true on success, otherwise Error() describes the failure.
+    bool Run() {
+        if (!Start()) {
+            return false;
+        }
+        Status status = Resume();
+        while (status == Status::kBarrier) {
+            status = Resume();
+        }
+        return status == Status::kFinished;
+    }
+
+    /// @returns the reason of the failure of Run()
+    const std::string& Error() const { return error_; }
+
+  private:
+    bool Fail(std::string message) {
+        error_ = std::move(message);
+        return false;
+    }
+
+    const RuntimeValue& Get(const Value* value) {
+        if (auto* c = value->As<Constant>()) {
+            // Constants are immutable, cache them like other values.
+            return values_.GetOrAdd(value, [&] { return RuntimeValue{c->Value(), {}}; });
+        }
+        auto result = values_.Get(value);
+        TINT_ASSERT(result);
+        return *result;
+    }
+
+    const constant::Value* GetValue(const Value* value) { return Get(value).value; }
+
+    void Set(const Value* value, const constant::Value* result) {
+        values_.Replace(value, RuntimeValue{result, {}});
+    }
+
+    void Set(const Value* value, Pointer pointer) {
+        values_.Replace(value, RuntimeValue{nullptr, pointer});
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Memory
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /// @returns the memory of a new variable of type @p type, zero-initialized.
+    Slice<uint8_t> Allocate(Hashmap<const Var*, std::vector<uint8_t>, 8>& memory,
+                            const Var* var,
+                            const type::Type* type) {
+        auto& bytes = memory.GetOrAdd(var, [] { return std::vector<uint8_t>{}; });
+        bytes.assign(type->Size(), 0);
+        return Slice<uint8_t>(bytes.data(), bytes.size());
+    }
+
+    /// @returns the value of type @p type stored at @p pointer, or zero if @p pointer is out of
+    /// bounds.
+    const constant::Value* Load(const type::Type* type, const Pointer& pointer) {
+        if (pointer.offset > pointer.memory.len ||
+            type->Size() > pointer.memory.len - pointer.offset) {
+            return constants_.Zero(type);
+        }
+        return Decode(type, pointer.memory.data + pointer.offset);
+    }
+
+    /// Stores @p value at @p pointer, unless @p pointer is out of bounds.
+    void Store(const constant::Value* value, const Pointer& pointer) {
+        const type::Type* type = value->Type();
+        if (pointer.offset > pointer.memory.len ||
+            type->Size() > pointer.memory.len - pointer.offset) {
+            return;
+        }
+        Encode(value, type, pointer.memory.data + pointer.offset);
+    }
+
+    const constant::Value* Decode(const type::Type* type, const uint8_t* bytes) {
+        auto composite = [&](const type::Type* composite_type, size_t count, auto&& offset_of) {
+            Vector<const constant::Value*, 16> elements;
+            for (size_t i = 0; i < count; i++) {
+                elements.Push(Decode(composite_type->Element(static_cast<uint32_t>(i)),
+                                     bytes + offset_of(i)));
+            }
+            return constants_.Composite(composite_type, std::move(elements));
+        };
+        return tint::Switch(
+            type,  //
+            [&](const type::Bool*) -> const constant::Value* {
+                uint32_t v;
+                memcpy(&v, bytes, sizeof(v));
+                return constants_.Get(v != 0);
+            },
+            [&](const type::I32*) -> const constant::Value* {
+                int32_t v;
+                memcpy(&v, bytes, sizeof(v));
+                return constants_.Get(i32(v));
+            },
+            [&](const type::U32*) -> const constant::Value* {
+                uint32_t v;
+                memcpy(&v, bytes, sizeof(v));
+                return constants_.Get(u32(v));
+            },
+            [&](const type::F32*) -> const constant::Value* {
+                float v;
+                memcpy(&v, bytes, sizeof(v));
+                return constants_.Get(f32(v));
+            },
+            [&](const type::F16*) -> const constant::Value* {
+                uint16_t v;
+                memcpy(&v, bytes, sizeof(v));
+                return constants_.Get(f16::FromBits(v));
+            },
+            [&](const type::Atomic* a) { return Decode(a->Type(), bytes); },
+            [&](const type::Vector* v) {
+                uint32_t stride = v->type()->Size();
+                return composite(v, v->Width(), [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Matrix* m) {
+                uint32_t stride = m->ColumnStride();
+                return composite(m, m->columns(), [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Array* a) {
+                uint32_t stride = a->Stride();
+                return composite(a, a->ConstantCount().value_or(0),
+                                 [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Struct* s) {
+                auto members = s->Members();
+                return composite(s, members.Length(),
+                                 [&](size_t i) { return members[i]->Offset(); });
+            },
+            TINT_ICE_ON_NO_MATCH);
+    }
+
+    void Encode(const constant::Value* value, const type::Type* type, uint8_t* bytes) {
+        auto composite = [&](size_t count, auto&& offset_of) {
+            for (size_t i = 0; i < count; i++) {
+                Encode(value->Index(i), type->Element(static_cast<uint32_t>(i)),
+                       bytes + offset_of(i));
+            }
+        };
+        tint::Switch(
+            type,  //
+            [&](const type::Bool*) {
+                uint32_t v = value->ValueAs<bool>() ? 1 : 0;
+                memcpy(bytes, &v, sizeof(v));
+            },
+            [&](const type::I32*) {
+                int32_t v = value->ValueAs<i32>();
+                memcpy(bytes, &v, sizeof(v));
+            },
+            [&](const type::U32*) {
+                uint32_t v = value->ValueAs<u32>();
+                memcpy(bytes, &v, sizeof(v));
+            },
+            [&](const type::F32*) {
+                float v = value->ValueAs<f32>();
+                memcpy(bytes, &v, sizeof(v));
+            },
+            [&](const type::F16*) {
+                uint16_t v = value->ValueAs<f16>().BitsRepresentation();
+                memcpy(bytes, &v, sizeof(v));
+            },
+            [&](const type::Atomic* a) { Encode(value, a->Type(), bytes); },
+            [&](const type::Vector* v) {
+                uint32_t stride = v->type()->Size();
+                composite(v->Width(), [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Matrix* m) {
+                uint32_t stride = m->ColumnStride();
+                composite(m->columns(), [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Array* a) {
+                uint32_t stride = a->Stride();
+                composite(a->ConstantCount().value_or(0), [&](size_t i) { return i * stride; });
+            },
+            [&](const type::Struct* s) {
+                auto members = s->Members();
+                composite(members.Length(), [&](size_t i) { return members[i]->Offset(); });
+            },
+            TINT_ICE_ON_NO_MATCH);
+    }
+
+    /// @returns @p index clamped to the number of elements of @p type, for robustness.
+    uint64_t ClampIndex(const type::Type* type, uint64_t index) {
+        auto count = type->Elements().count;
+        if (count == 0) {
+            // Runtime-sized array, the access is checked against the size of the memory.
+            return index;
+        }
+        return std::min<uint64_t>(index, count - 1);
+    }
+
+    /// @returns the index held by @p value. Negative indices are clamped to zero.
+    uint64_t GetIndex(const Value* value) {
+        int64_t index = GetValue(value)->ValueAs<AInt>();
+        return index < 0 ? 0 : static_cast<uint64_t>(index);
+    }
+
+    /// @returns the byte offset of element @p index of @p type.
+    uint64_t ElementOffset(const type::Type* type, uint64_t index) {
+        return tint::Switch(
+            type,  //
+            [&](const type::Vector* v) -> uint64_t { return index * v->type()->Size(); },
+            [&](const type::Matrix* m) -> uint64_t { return index * m->ColumnStride(); },
+            [&](const type::Array* a) -> uint64_t { return index * a->Stride(); },
+            [&](const type::Struct* s) -> uint64_t {
+                return s->Members()[static_cast<size_t>(index)]->Offset();
+            },
+            TINT_ICE_ON_NO_MATCH);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Setup
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BindModuleScopeVars() {
+        if (!dispatch_.mod.root_block) {
+            return true;
+        }
+        for (auto* inst : *dispatch_.mod.root_block) {
+            auto* var = inst->As<Var>();
+            if (!var) {
+                return Fail("unsupported module-scope instruction: " + inst->FriendlyName());
+            }
+            auto* ptr = var->Result(0)->Type()->As<type::Pointer>();
+            switch (ptr->AddressSpace()) {
+                case AddressSpace::kStorage:
+                case AddressSpace::kUniform: {
+                    // Unbound buffers are treated as empty.
+                    auto buffer = dispatch_.buffers.Get(var);
+                    Set(var->Result(0), Pointer{buffer ? *buffer : Slice<uint8_t>{}, 0});
+                    break;
+                }
+                case AddressSpace::kWorkgroup: {
+                    auto memory = workgroup_.memory.Get(var);
+                    TINT_ASSERT(memory);
+                    Set(var->Result(0), Pointer{Slice<uint8_t>(memory->data(), memory->size()), 0});
+                    break;
+                }
+                case AddressSpace::kPrivate: {
+                    Pointer pointer{Allocate(private_memory_, var, ptr->StoreType()), 0};
+                    if (auto* init = var->Initializer()) {
+                        auto* c = init->As<Constant>();
+                        if (!c) {
+                            return Fail("unsupported non-constant private variable initializer");
+                        }
+                        Store(c->Value(), pointer);
+                    }
+                    Set(var->Result(0), pointer);
+                    break;
+                }
+                default:
+                    return Fail("unsupported module-scope variable address space: " +
+                                std::string(ToString(ptr->AddressSpace())));
+            }
+        }
+        return true;
+    }
+
+    /// @returns the value of the builtin @p builtin of type @p type for this invocation, or
+    /// nullptr if the builtin is not supported.
+    const constant::Value* BuiltinValue(core::BuiltinValue builtin, const type::Type* type) {
+        auto vec3 = [&](std::array<uint32_t, 3> v) {
+            return constants_.Composite(
+                type, Vector<const constant::Value*, 3>{constants_.Get(u32(v[0])),
+                                                        constants_.Get(u32(v[1])),
+                                                        constants_.Get(u32(v[2]))});
+        };
+        const auto& size = dispatch_.workgroup_size;
+        const auto& id = workgroup_.id;
+        switch (builtin) {
+            case core::BuiltinValue::kLocalInvocationId:
+                return vec3(local_id_);
+            case core::BuiltinValue::kLocalInvocationIndex:
+                return constants_.Get(
+                    u32(local_id_[0] + size[0] * (local_id_[1] + size[1] * local_id_[2])));
+            case core::BuiltinValue::kGlobalInvocationId:
+                return vec3({id[0] * size[0] + local_id_[0], id[1] * size[1] + local_id_[1],
+                             id[2] * size[2] + local_id_[2]});
+            case core::BuiltinValue::kWorkgroupId:
+                return vec3(id);
+            case core::BuiltinValue::kNumWorkgroups:
+                return vec3(dispatch_.num_workgroups);
+            default:
+                return nullptr;
+        }
+    }
+
+    bool BindEntryPointParams() {
+        for (auto* param : dispatch_.entry_point->Params()) {
+            const constant::Value* value = nullptr;
+            if (auto builtin = param->Builtin()) {
+                value = BuiltinValue(*builtin, param->Type());
+            } else if (auto* str = param->Type()->As<type::Struct>()) {
+                Vector<const constant::Value*, 4> members;
+                for (auto* member : str->Members()) {
+                    auto member_builtin = member->Attributes().builtin;
+                    auto* member_value =
+                        member_builtin ? BuiltinValue(*member_builtin, member->Type()) : nullptr;
+                    if (!member_value) {
+                        return Fail("unsupported entry point parameter");
+                    }
+                    members.Push(member_value);
+                }
+                value = constants_.Composite(str, std::move(members));
+            }
+            if (!value) {
+                return Fail("unsupported entry point parameter");
+            }
+            Set(param, value);
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Control flow
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /// A block being run by the invocation
+    struct Frame {
+        /// The block
+        const Block* block = nullptr;
+        /// The next instruction to run, or nullptr if the block has no terminator and all its
+        /// instructions have run
+        const Instruction* next = nullptr;
+        /// The control instruction or user call that entered the block, or nullptr for the block
+        /// of the entry point
+        const Instruction* owner = nullptr;
+    };
+
+    /// Starts running @p block, entered by @p owner.
+    void Enter(const Block* block, const Instruction* owner) {
+        frames_.Push(Frame{block, block->Front(), owner});
+    }
+
+    /// Leaves the current block with @p terminator. Terminators that exit an enclosing control
+    /// instruction or function also leave the blocks in between.
+    /// @param terminator the terminator, or nullptr if the block has no terminator
+    /// @returns false on failure
+    bool Exit(const Terminator* terminator) {
+        while (!frames_.IsEmpty()) {
+            Frame frame = frames_.Pop();
+            if (!frame.owner) {
+                // Leaving the block of the entry point ends the invocation.
+                return true;
+            }
+
+            if (auto* call = frame.owner->As<UserCall>()) {
+                auto* ret = tint::As<Return>(terminator);
+                if (!ret) {
+                    return Fail("function does not end with a return");
+                }
+                if (auto* value = ret->Value()) {
+                    values_.Replace(call->Result(0), Get(value));
+                }
+                return true;
+            }
+
+            if (auto* if_ = frame.owner->As<If>()) {
+                if (auto* exit = tint::As<ExitIf>(terminator); exit && exit->If() == if_) {
+                    SetAll(if_->Results(), exit->Args());
+                    return true;
+                }
+            } else if (auto* switch_ = frame.owner->As<ir::Switch>()) {
+                if (auto* exit = tint::As<ExitSwitch>(terminator);
+                    exit && exit->Switch() == switch_) {
+                    SetAll(switch_->Results(), exit->Args());
+                    return true;
+                }
+            } else if (auto* loop = frame.owner->As<Loop>()) {
+                if (frame.block == loop->Body() && !terminator) {
+                    return Fail("loop body has no terminator");
+                }
+                if (ExitLoopBlock(loop, frame.block, terminator)) {
+                    return true;
+                }
+            }
+
+            if (!terminator) {
+                // The control instruction ends with its block.
+                return true;
+            }
+            // The terminator exits through the control instruction, continue with the block
+            // that contains it.
+        }
+        return true;
+    }
+
+    /// Leaves @p block, a block of @p loop, with @p terminator.
+    /// @returns true if @p terminator continues or exits @p loop, false if it exits through it
+    bool ExitLoopBlock(const Loop* loop, const Block* block, const Terminator* terminator) {
+        if (auto* next = tint::As<NextIteration>(terminator); next && next->Loop() == loop) {
+            SetAll(loop->Body()->Params(), next->Args());
+            Enter(loop->Body(), loop);
+            return true;
+        }
+
+        if (block == loop->Body()) {
+            if (auto* exit = tint::As<ExitLoop>(terminator); exit && exit->Loop() == loop) {
+                SetAll(loop->Results(), exit->Args());
+                return true;
+            }
+            if (auto* cont = tint::As<Continue>(terminator); cont && cont->Loop() == loop) {
+                SetAll(loop->Continuing()->Params(), cont->Args());
+                Enter(loop->Continuing(), loop);
+                return true;
+            }
+        } else if (block == loop->Continuing()) {
+            if (!terminator) {
+                Enter(loop->Body(), loop);
+                return true;
+            }
+            if (auto* break_if = terminator->As<BreakIf>(); break_if && break_if->Loop() == loop) {
+                if (GetValue(break_if->Condition())->ValueAs<bool>()) {
+                    SetAll(loop->Results(), break_if->ExitValues());
+                    return true;
+                }
+                SetAll(loop->Body()->Params(), break_if->NextIterValues());
+                Enter(loop->Body(), loop);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Sets the results of @p inst, or the parameters of a block, to the values of @p args.
+    template <typename TARGETS, typename ARGS>
+    void SetAll(TARGETS&& targets, ARGS&& args) {
+        // Read all the arguments first as they may refer to the targets.
+        Vector<RuntimeValue, 4> values;
+        for (auto* arg : args) {
+            values.Push(Get(arg));
+        }
+        for (size_t i = 0; i < values.Length() && i < targets.Length(); i++) {
+            values_.Replace(targets[i], values[i]);
+        }
+    }
+
+    void ExecSwitch(const ir::Switch* switch_) {
+        int64_t condition = GetValue(switch_->Condition())->ValueAs<AInt>();
+        const Block* target = nullptr;
+        for (auto& c : switch_->Cases()) {
+            for (auto& selector : c.selectors) {
+                if (selector.IsDefault()) {
+                    if (!target) {
+                        target = c.block;
+                    }
+                } else if (selector.val->Value()->ValueAs<AInt>() == condition) {
+                    target = c.block;
+                    break;
+                }
+            }
+        }
+        if (target) {
+            Enter(target, switch_);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /// Runs @p inst. Control instructions and user calls enter the block to run next.
+    /// @returns false on failure
+    bool Exec(const Instruction* inst) {
+        return tint::Switch(
+            inst,  //
+            [&](const If* i) {
+                Enter(GetValue(i->Condition())->ValueAs<bool>() ? i->True() : i->False(), i);
+                return true;
+            },
+            [&](const ir::Switch* s) {
+                ExecSwitch(s);
+                return true;
+            },
+            [&](const Loop* l) {
+                Enter(l->Initializer()->IsEmpty() ? l->Body() : l->Initializer(), l);
+                return true;
+            },
+            [&](const UserCall* c) {
+                SetAll(c->Target()->Params(), c->Args());
+                Enter(c->Target()->Block(), c);
+                return true;
+            },
+            [&](const Var* v) { return ExecVar(v); },
+            [&](const Let* l) {
+                values_.Replace(l->Result(0), Get(l->Value()));
+                return true;
+            },
+            [&](const ir::Load* l) {
+                Set(l->Result(0), Load(l->Result(0)->Type(), Get(l->From()).pointer));
+                return true;
+            },
+            [&](const ir::Store* s) {
+                Store(GetValue(s->From()), Get(s->To()).pointer);
+                return true;
+            },
+            [&](const LoadVectorElement* l) {
+                Pointer pointer = Get(l->From()).pointer;
+                auto* vec = l->From()->Type()->UnwrapPtr();
+                pointer.offset += ElementOffset(vec, ClampIndex(vec, GetIndex(l->Index())));
+                Set(l->Result(0), Load(l->Result(0)->Type(), pointer));
+                return true;
+            },
+            [&](const StoreVectorElement* s) {
+                Pointer pointer = Get(s->To()).pointer;
+                auto* vec = s->To()->Type()->UnwrapPtr();
+                pointer.offset += ElementOffset(vec, ClampIndex(vec, GetIndex(s->Index())));
+                Store(GetValue(s->Value()), pointer);
+                return true;
+            },
+            [&](const Access* a) { return ExecAccess(a); },
+            [&](const Swizzle* s) {
+                auto* vec = GetValue(s->Object());
+                Vector<const constant::Value*, 4> elements;
+                for (auto index : s->Indices()) {
+                    elements.Push(vec->Index(index));
+                }
+                Set(s->Result(0), constants_.Composite(s->Result(0)->Type(), std::move(elements)));
+                return true;
+            },
+            [&](const Construct* c) { return ExecConstruct(c); },
+            [&](const Convert* c) {
+                return SetEvalResult(c, eval_.Convert(c->Result(0)->Type(),
+                                                      GetValue(c->Args()[0]), Source{}));
+            },
+            [&](const Bitcast* b) {
+                return SetEvalResult(b, eval_.bitcast(b->Result(0)->Type(),
+                                                      Vector{GetValue(b->Val())}, Source{}));
+            },
+            [&](const CoreBuiltinCall* c) { return ExecBuiltin(c); },
+            [&](const CoreBinary* b) {
+                return EvalWith(b, Vector{GetValue(b->LHS()), GetValue(b->RHS())});
+            },
+            [&](const CoreUnary* u) { return EvalWith(u, Vector{GetValue(u->Val())}); },
+            [&](Default) { return Fail("unsupported instruction: " + inst->FriendlyName()); });
+    }
+
+    bool ExecVar(const Var* var) {
+        auto* ptr = var->Result(0)->Type()->As<type::Pointer>();
+        if (ptr->AddressSpace() != AddressSpace::kFunction) {
+            return Fail("unsupported function-scope variable address space");
+        }
+        Pointer pointer{Allocate(function_memory_, var, ptr->StoreType()), 0};
+        if (auto* init = var->Initializer()) {
+            Store(GetValue(init), pointer);
+        }
+        Set(var->Result(0), pointer);
+        return true;
+    }
+
+    bool ExecAccess(const Access* access) {
+        const RuntimeValue& object = Get(access->Object());
+        const type::Type* type = access->Object()->Type();
+        if (auto* ptr = type->As<type::Pointer>()) {
+            Pointer pointer = object.pointer;
+            type = ptr->StoreType();
+            for (auto* index_value : access->Indices()) {
+                uint64_t index = ClampIndex(type, GetIndex(index_value));
+                pointer.offset += ElementOffset(type, index);
+                type = type->Element(static_cast<uint32_t>(index));
+            }
+            Set(access->Result(0), pointer);
+            return true;
+        }
+
+        const constant::Value* value = object.value;
+        for (auto* index_value : access->Indices()) {
+            value = value->Index(ClampIndex(value->Type(), GetIndex(index_value)));
+        }
+        Set(access->Result(0), value);
+        return true;
+    }
+
+    bool ExecConstruct(const Construct* construct) {
+        const type::Type* type = construct->Result(0)->Type();
+        auto args = construct->Args();
+        if (args.IsEmpty()) {
+            Set(construct->Result(0), constants_.Zero(type));
+            return true;
+        }
+
+        Vector<const constant::Value*, 16> elements;
+        if (auto* vec = type->As<type::Vector>()) {
+            if (args.Length() == 1 && args[0]->Type()->Is<type::Scalar>()) {
+                Set(construct->Result(0), constants_.Splat(vec, GetValue(args[0])));
+                return true;
+            }
+            // Flatten the scalar and vector arguments.
+            for (auto* arg : args) {
+                auto* value = GetValue(arg);
+                if (arg->Type()->Is<type::Vector>()) {
+                    for (size_t i = 0; i < value->NumElements(); i++) {
+                        elements.Push(value->Index(i));
+                    }
+                } else {
+                    elements.Push(value);
+                }
+            }
+        } else if (auto* mat = type->As<type::Matrix>();
+                   mat && args.Length() == mat->columns() * mat->rows()) {
+            // Group the scalar arguments in columns.
+            for (uint32_t c = 0; c < mat->columns(); c++) {
+                Vector<const constant::Value*, 4> column;
+                for (uint32_t r = 0; r < mat->rows(); r++) {
+                    column.Push(GetValue(args[c * mat->rows() + r]));
+                }
+                elements.Push(constants_.Composite(mat->ColumnType(), std::move(column)));
+            }
+        } else {
+            for (auto* arg : args) {
+                elements.Push(GetValue(arg));
+            }
+        }
+        Set(construct->Result(0), constants_.Composite(type, std::move(elements)));
+        return true;
+    }
+
+    bool SetEvalResult(const Instruction* inst, const constant::Eval::Result& result) {
+        if (result != Success || !result.Get()) {
+            return Fail("failed to evaluate " + inst->FriendlyName());
+        }
+        Set(inst->Result(0), result.Get());
+        return true;
+    }
+
+    bool EvalWith(const Instruction* inst, VectorRef<const constant::Value*> args) {
+        auto fn = dispatch_.eval_fns.Get(inst);
+        if (!fn) {
+            return Fail("unsupported instruction: " + inst->FriendlyName());
+        }
+        return SetEvalResult(inst, (eval_.*(*fn))(inst->Result(0)->Type(), args, Source{}));
+    }
+
+    bool ExecBuiltin(const CoreBuiltinCall* call) {
+        switch (call->Func()) {
+            case BuiltinFn::kArrayLength: {
+                auto* arr = call->Args()[0]->Type()->UnwrapPtr()->As<type::Array>();
+                const Pointer& pointer = Get(call->Args()[0]).pointer;
+                uint64_t size = pointer.memory.len > pointer.offset
+                                    ? (pointer.memory.len - pointer.offset) / arr->Stride()
+                                    : 0;
+                Set(call->Result(0), constants_.Get(u32(static_cast<uint32_t>(size))));
+                return true;
+            }
+            case BuiltinFn::kAtomicLoad:
+            case BuiltinFn::kAtomicStore:
+            case BuiltinFn::kAtomicAdd:
+            case BuiltinFn::kAtomicSub:
+            case BuiltinFn::kAtomicMax:
+            case BuiltinFn::kAtomicMin:
+            case BuiltinFn::kAtomicAnd:
+            case BuiltinFn::kAtomicOr:
+            case BuiltinFn::kAtomicXor:
+            case BuiltinFn::kAtomicExchange:
+            case BuiltinFn::kAtomicCompareExchangeWeak:
+                return ExecAtomic(call);
+            default:
+                break;
+        }
+
+        Vector<const constant::Value*, 4> args;
+        for (auto* arg : call->Args()) {
+            args.Push(GetValue(arg));
+        }
+        return EvalWith(call, std::move(args));
+    }
+
+    bool ExecAtomic(const CoreBuiltinCall* call) {
+        const Pointer& pointer = Get(call->Args()[0]).pointer;
+        auto* type = call->Args()[0]->Type()->UnwrapPtr()->As<type::Atomic>()->Type();
+        bool is_signed = type->Is<type::I32>();
+
+        std::lock_guard<std::mutex> lock(dispatch_.atomic_mutex);
+        auto* old_value = Load(type, pointer);
+        if (call->Func() == BuiltinFn::kAtomicLoad) {
+            Set(call->Result(0), old_value);
+            return true;
+        }
+
+        uint32_t old_bits = old_value->ValueAs<u32>();
+        uint32_t operand =
+            call->Args().Length() > 1 ? GetValue(call->Args()[1])->ValueAs<u32>() : 0;
+        uint32_t new_bits = old_bits;
+        switch (call->Func()) {
+            case BuiltinFn::kAtomicStore:
+            case BuiltinFn::kAtomicExchange:
+                new_bits = operand;
+                break;
+            case BuiltinFn::kAtomicAdd:
+                new_bits = old_bits + operand;
+                break;
+            case BuiltinFn::kAtomicSub:
+                new_bits = old_bits - operand;
+                break;
+            case BuiltinFn::kAtomicMax:
+                if (is_signed) {
+                    new_bits = static_cast<uint32_t>(
+                        std::max(static_cast<int32_t>(old_bits), static_cast<int32_t>(operand)));
+                } else {
+                    new_bits = std::max(old_bits, operand);
+                }
+                break;
+            case BuiltinFn::kAtomicMin:
+                if (is_signed) {
+                    new_bits = static_cast<uint32_t>(
+                        std::min(static_cast<int32_t>(old_bits), static_cast<int32_t>(operand)));
+                } else {
+                    new_bits = std::min(old_bits, operand);
+                }
+                break;
+            case BuiltinFn::kAtomicAnd:
+                new_bits = old_bits & operand;
+                break;
+            case BuiltinFn::kAtomicOr:
+                new_bits = old_bits | operand;
+                break;
+            case BuiltinFn::kAtomicXor:
+                new_bits = old_bits ^ operand;
+                break;
+            case BuiltinFn::kAtomicCompareExchangeWeak: {
+                uint32_t value = GetValue(call->Args()[2])->ValueAs<u32>();
+                bool exchanged = old_bits == operand;
+                if (exchanged) {
+                    new_bits = value;
+                }
+                Vector<const constant::Value*, 2> result{old_value, constants_.Get(exchanged)};
+                Set(call->Result(0), constants_.Composite(call->Result(0)->Type(), result));
+                break;
+            }
+            default:
+                TINT_UNREACHABLE();
+        }
+
+        auto* new_value = is_signed ? static_cast<const constant::Value*>(
+                                          constants_.Get(i32(static_cast<int32_t>(new_bits))))
+                                    : constants_.Get(u32(new_bits));
+        Store(new_value, pointer);
+        if (call->Func() != BuiltinFn::kAtomicStore &&
+            call->Func() != BuiltinFn::kAtomicCompareExchangeWeak) {
+            Set(call->Result(0), old_value);
+        }
+        return true;
+    }
+
+    const DispatchState& dispatch_;
+    WorkgroupState& workgroup_;
+    constant::Manager& constants_;
+    diag::List diagnostics_;
+    constant::Eval eval_;
+    const std::array<uint32_t, 3> local_id_;
+
+    Vector<Frame, 16> frames_;
+    Hashmap<const Value*, RuntimeValue, 64> values_;
+    Hashmap<const Var*, std::vector<uint8_t>, 8> function_memory_;
+    Hashmap<const Var*, std::vector<uint8_t>, 8> private_memory_;
+    std::string error_;
+};
+
+/// Runs all the invocations of the workgroup @p id, creating their values in @p constants.
+Result<SuccessType> RunWorkgroup(const DispatchState& state,
+                                 constant::Manager& constants,
+                                 std::array<uint32_t, 3> id) {
+    const auto& size = state.workgroup_size;
+    const uint32_t invocation_count = size[0] * size[1] * size[2];
+
+    WorkgroupState workgroup;
+    workgroup.id = id;
+    if (state.mod.root_block) {
+        for (auto* inst : *state.mod.root_block) {
+            auto* var = inst->As<Var>();
+            auto* ptr = var ? var->Result(0)->Type()->As<type::Pointer>() : nullptr;
+            if (ptr && ptr->AddressSpace() == AddressSpace::kWorkgroup) {
+                workgroup.memory.Add(var, std::vector<uint8_t>(ptr->StoreType()->Size(), 0));
+            }
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> local_ids;
+    local_ids.reserve(invocation_count);
+    for (uint32_t z = 0; z < size[2]; z++) {
+        for (uint32_t y = 0; y < size[1]; y++) {
+            for (uint32_t x = 0; x < size[0]; x++) {
+                local_ids.push_back({x, y, z});
+            }
+        }
+    }
+
+    if (!state.use_barriers) {
+        for (auto& local_id : local_ids) {
+            Invocation invocation(state, workgroup, constants, local_id);
+            if (!invocation.Run()) {
+                return Failure{invocation.Error()};
+            }
+        }
+        return Success;
+    }
+
+    // The invocations are interleaved on this thread: each one runs until its next barrier, and
+    // the barrier is released once all the invocations that have not finished have reached it.
+    std::vector<std::unique_ptr<Invocation>> invocations;
+    invocations.reserve(local_ids.size());
+    for (auto& local_id : local_ids) {
+        auto& invocation = invocations.emplace_back(
+            std::make_unique<Invocation>(state, workgroup, constants, local_id));
+        if (!invocation->Start()) {
+            return Failure{invocation->Error()};
+        }
+    }
+    size_t running = invocations.size();
+    while (running > 0) {
+        for (auto& invocation : invocations) {
+            if (!invocation) {
+                continue;
+            }
+            switch (invocation->Resume()) {
+                case Invocation::Status::kFinished:
+                    invocation.reset();
+                    running--;
+                    break;
+                case Invocation::Status::kBarrier:
+                    break;
+                case Invocation::Status::kFailed:
+                    return Failure{invocation->Error()};
+            }
+        }
+    }
+    return Success;
+}
+
+/// Resolves the constant evaluation functions of the instructions of @p mod into @p eval_fns.
+Result<SuccessType> ResolveEvalFns(Module& mod, EvalFns& eval_fns) {
+    auto types = type::Manager::Wrap(mod.Types());
+    auto symbols = SymbolTable::Wrap(mod.symbols);
+
+    auto resolve = [&](const Instruction* inst, auto&& overload) -> Result<SuccessType> {
+        if (overload != Success) {
+            return Failure{overload.Failure().Plain()};
+        }
+        if (overload->const_eval_fn) {
+            eval_fns.Add(inst, overload->const_eval_fn);
+        }
+        return Success;
+    };
+
+    for (auto* inst : mod.Instructions()) {
+        Result<SuccessType> result = Success;
+        tint::Switch(
+            inst,  //
+            [&](const CoreBinary* b) {
+                intrinsic::Context context{b->TableData(), types, symbols};
+                result = resolve(b, intrinsic::LookupBinary(context, b->Op(), b->LHS()->Type(),
+                                                            b->RHS()->Type(),
+                                                            EvaluationStage::kRuntime,
+                                                            /* is_compound */ false));
+            },
+            [&](const CoreUnary* u) {
+                intrinsic::Context context{u->TableData(), types, symbols};
+                result = resolve(u, intrinsic::LookupUnary(context, u->Op(), u->Val()->Type(),
+                                                           EvaluationStage::kRuntime));
+            },
+            [&](const CoreBuiltinCall* c) {
+                intrinsic::Context context{c->TableData(), types, symbols};
+                Vector<const type::Type*, 4> args;
+                for (auto* arg : c->Args()) {
+                    args.Push(arg->Type());
+                }
+                result = resolve(c, intrinsic::LookupFn(context, c->FriendlyName().c_str(),
+                                                        c->FuncId(), Empty, std::move(args),
+                                                        EvaluationStage::kRuntime));
+            });
+        if (result != Success) {
+            return result.Failure();
+        }
+    }
+    return Success;
+}
+
+}  // namespace
+
+/// The state of the interpreter that only depends on the module, built by the first Dispatch()
+struct Interpreter::Cache {
+    /// A compute entry point of the module
+    struct EntryPoint {
+        /// The function of the entry point
+        const Function* function = nullptr;
+        /// The workgroup size of the entry point
+        std::array<uint32_t, 3> workgroup_size{};
+        /// True if the invocations of a workgroup need to be interleaved at barriers
+        bool use_barriers = false;
+    };
+
+    /// The result of resolving the constant evaluation functions
+    Result<SuccessType> resolved;
+    /// The constant evaluation functions of the binary, unary and builtin instructions
+    EvalFns eval_fns;
+    /// The compute entry points, by name
+    Hashmap<std::string, EntryPoint, 4> entry_points;
+};
+
+Interpreter::Interpreter(Module& module) : module_(module) {}
+
+Interpreter::~Interpreter() = default;
+
+void Interpreter::BindBuffer(BindingPoint binding_point, Slice<uint8_t> memory) {
+    buffers_.Replace(binding_point, memory);
+}
+
+Result<SuccessType> Interpreter::Dispatch(std::string_view entry_point,
+                                          std::array<uint32_t, 3> num_workgroups) {
+    if (!cache_) {
+        cache_ = std::make_unique<Cache>();
+        cache_->resolved = ResolveEvalFns(module_, cache_->eval_fns);
+        for (auto& func : module_.functions) {
+            if (func->Stage() != Function::PipelineStage::kCompute) {
+                continue;
+            }
+            Cache::EntryPoint info;
+            info.function = func.Get();
+            info.workgroup_size = func->WorkgroupSize().value_or(std::array{1u, 1u, 1u});
+            const auto& size = info.workgroup_size;
+            Hashset<const Function*, 8> visited;
+            info.use_barriers =
+                size[0] * size[1] * size[2] > 1 && UsesBarriers(func->Block(), visited);
+            cache_->entry_points.Add(module_.NameOf(func.Get()).Name(), info);
+        }
+    }
+
+    auto info = cache_->entry_points.Get(std::string(entry_point));
+    if (!info) {
+        return Failure{"compute entry point '" + std::string(entry_point) + "' not found"};
+    }
+    if (cache_->resolved != Success) {
+        return cache_->resolved.Failure();
+    }
+
+    DispatchState state(module_, cache_->eval_fns);
+    state.num_workgroups = num_workgroups;
+    state.entry_point = info->function;
+    state.workgroup_size = info->workgroup_size;
+    state.use_barriers = info->use_barriers;
+
+    if (module_.root_block) {
+        for (auto* inst : *module_.root_block) {
+            auto* var = inst->As<Var>();
+            if (!var || !var->BindingPoint()) {
+                continue;
+            }
+            if (auto memory = buffers_.Get(*var->BindingPoint())) {
+                state.buffers.Add(var, *memory);
+            }
+        }
+    }
+
+    // Workgroups are independent, so they are handed out one at a time to the calling thread and
+    // to helper threads, up to the hardware concurrency.
+    const uint64_t workgroup_count =
+        uint64_t(num_workgroups[0]) * num_workgroups[1] * num_workgroups[2];
+    const uint64_t thread_count =
+        std::min<uint64_t>(workgroup_count, std::max(1u, std::thread::hardware_concurrency()));
+    std::atomic<uint64_t> next_workgroup{0};
+    std::atomic<bool> failed{false};
+    std::mutex error_mutex;
+    diag::List error;
+    auto worker = [&] {
+        // The constant manager isn't thread safe, so each thread extends the constants of the
+        // module with its own. Wrapping copies the module's constants, so it is done once per
+        // thread instead of once per workgroup, and the values created by the invocations are
+        // released when the dispatch is done.
+        auto constants = constant::Manager::Wrap(module_.constant_values);
+        while (!failed.load(std::memory_order_relaxed)) {
+            uint64_t index = next_workgroup++;
+            if (index >= workgroup_count) {
+                return;
+            }
+            std::array<uint32_t, 3> id{
+                static_cast<uint32_t>(index % num_workgroups[0]),
+                static_cast<uint32_t>((index / num_workgroups[0]) % num_workgroups[1]),
+                static_cast<uint32_t>(index / (uint64_t(num_workgroups[0]) * num_workgroups[1])),
+            };
+            auto result = RunWorkgroup(state, constants, id);
+            if (result != Success) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!failed.exchange(true)) {
+                    error = result.Failure().reason;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> helpers;
+    helpers.reserve(thread_count);
+    for (uint64_t i = 1; i < thread_count; i++) {
+#if defined(__cpp_exceptions)
+        try {
+            helpers.emplace_back(worker);
+        } catch (const std::system_error&) {
+            // Failing to create a thread only reduces the parallelism of the dispatch.
+            break;
+        }
+#else
+        helpers.emplace_back(worker);
+#endif
+    }
+    worker();
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+
+    if (failed) {
+        return Failure{error};
+    }
+    return Success;
+}
+
+}  // namespace tint::core::ir::interpreter
@@ -0,0 +1,99 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_INTERPRETER_INTERPRETER_H_
+#define SRC_TINT_LANG_CORE_IR_INTERPRETER_INTERPRETER_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "src/tint/api/common/binding_point.h"
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/slice.h"
+#include "src/tint/utils/result/result.h"
+
+// Forward declarations
+namespace tint::core::ir {
+class Module;
+}  // namespace tint::core::ir
+
+namespace tint::core::ir::interpreter {
+
+/// Interpreter executes the compute entry points of a core IR module on the CPU.
+///
+/// Storage and uniform buffers are bound to host memory, which is read and written using the WGSL
+/// memory layout of the buffer types. Values are represented with core::constant::Value and
+/// operations are evaluated with core::constant::Eval using runtime semantics. Out-of-bounds
+/// accesses are handled as if the robustness transform had been applied: loads return zero and
+/// stores are dropped.
+///
+/// Workgroups are handed out one at a time to the calling thread and to at most as many helper
+/// threads as the hardware supports. The invocations of a workgroup run on the thread of the
+/// workgroup, in sequence, or interleaved at barriers if the entry point uses them. Atomic
+/// operations are serialized across the whole dispatch.
+///
+/// The module is analyzed by the first call to Dispatch(), and the result is reused by the later
+/// ones, so an Interpreter should be kept for as long as its module is run.
+///
+/// Textures, samplers and subgroup builtins are not supported and make Dispatch() fail.
+class Interpreter {
+  public:
+    /// Constructor
+    /// @param module the module to run. The module must not be modified while the interpreter is
+    /// alive.
+    explicit Interpreter(Module& module);
+
+    /// Destructor
+    ~Interpreter();
+
+    /// Binds host memory to the storage or uniform buffer variable at @p binding_point. Buffers
+    /// that are not bound behave as if they were empty.
+    /// @param binding_point the binding point of the variable
+    /// @param memory the memory of the buffer. Must stay valid during Dispatch().
+    void BindBuffer(BindingPoint binding_point, Slice<uint8_t> memory);
+
+    /// Runs the compute entry point @p entry_point for each workgroup of the grid of
+    /// @p num_workgroups.
+    /// @param entry_point the name of the entry point
+    /// @param num_workgroups the number of workgroups in each dimension
+    /// @returns success or failure
+    Result<SuccessType> Dispatch(std::string_view entry_point,
+                                 std::array<uint32_t, 3> num_workgroups);
+
+  private:
+    struct Cache;
+
+    Module& module_;
+    Hashmap<BindingPoint, Slice<uint8_t>, 8> buffers_;
+    std::unique_ptr<Cache> cache_;
+};
+
+}  // namespace tint::core::ir::interpreter
+
+#endif  // SRC_TINT_LANG_CORE_IR_INTERPRETER_INTERPRETER_H_
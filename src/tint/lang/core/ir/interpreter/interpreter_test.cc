@@ -0,0 +1,323 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/interpreter/interpreter.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/wgsl/reader/reader.h"
+
+namespace tint::core::ir::interpreter {
+namespace {
+
+class IR_InterpreterTest : public testing::Test {
+  public:
+    /// Parses @p wgsl and runs its entry point `main` over @p num_workgroups, with @p buffers
+    /// bound to @group(0) @binding(i).
+    /// @returns an empty string on success, otherwise the failure
+    std::string Run(std::string wgsl,
+                    std::array<uint32_t, 3> num_workgroups,
+                    std::vector<std::vector<uint32_t>*> buffers) {
+        Source::File file{"test", wgsl};
+        auto module = wgsl::reader::WgslToIR(&file);
+        if (module != Success) {
+            return "WgslToIR() failed:\n" + module.Failure().reason.Str();
+        }
+
+        Interpreter interpreter(module.Get());
+        for (uint32_t i = 0; i < buffers.size(); i++) {
+            interpreter.BindBuffer(BindingPoint{0, i},
+                                   Slice<uint8_t>(reinterpret_cast<uint8_t*>(buffers[i]->data()),
+                                                  buffers[i]->size() * sizeof(uint32_t)));
+        }
+        auto result = interpreter.Dispatch("main", num_workgroups);
+        if (result != Success) {
+            return result.Failure().reason.Str();
+        }
+        return "";
+    }
+};
+
+TEST_F(IR_InterpreterTest, GlobalInvocationId) {
+    std::vector<uint32_t> out(16, 0);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+@compute @workgroup_size(4)
+fn main(@builtin(global_invocation_id) id : vec3u) {
+  out[id.x] = id.x * 2;
+}
+)",
+                  {4, 1, 1}, {&out}),
+              "");
+    for (uint32_t i = 0; i < out.size(); i++) {
+        EXPECT_EQ(out[i], i * 2) << "index " << i;
+    }
+}
+
+TEST_F(IR_InterpreterTest, ControlFlowAndFunctions) {
+    std::vector<uint32_t> in{1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<uint32_t> out(4, 0);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read> in : array<u32>;
+@group(0) @binding(1) var<storage, read_write> out : array<u32>;
+
+fn sum_odd(count : u32) -> u32 {
+  var sum = 0u;
+  for (var i = 0u; i < count; i++) {
+    if ((in[i] & 1) == 0) {
+      continue;
+    }
+    sum += in[i];
+  }
+  return sum;
+}
+
+@compute @workgroup_size(1)
+fn main() {
+  out[0] = sum_odd(arrayLength(&in));
+  var n = 0u;
+  loop {
+    n++;
+    continuing {
+      break if n >= 10;
+    }
+  }
+  out[1] = n;
+  switch (n) {
+    case 3: { out[2] = 3; }
+    case 10, 11: { out[2] = 10; }
+    default: { out[2] = 0; }
+  }
+  out[3] = u32(f32(n) * 1.5f);
+}
+)",
+                  {1, 1, 1}, {&in, &out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{16, 10, 10, 15}));
+}
+
+TEST_F(IR_InterpreterTest, StructLayout) {
+    std::vector<uint32_t> data{1, 2, 3, 0, 0, 0};
+    EXPECT_EQ(Run(R"(
+struct S {
+  a : vec3<u32>,
+  b : u32,
+  c : array<u32, 2>,
+}
+@group(0) @binding(0) var<storage, read_write> s : S;
+
+@compute @workgroup_size(1)
+fn main() {
+  s.b = s.a.x + s.a.y + s.a.z;
+  s.c[1] = s.a[2];
+  s.a = s.a.zyx;
+}
+)",
+                  {1, 1, 1}, {&data}),
+              "");
+    EXPECT_EQ(data, (std::vector<uint32_t>{3, 2, 1, 6, 0, 3}));
+}
+
+TEST_F(IR_InterpreterTest, OutOfBoundsAccessesAreRobust) {
+    std::vector<uint32_t> out(4, 7);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+@compute @workgroup_size(1)
+fn main() {
+  let value = out[10];
+  out[20] = 42;
+  out[0] = value;
+}
+)",
+                  {1, 1, 1}, {&out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{0, 7, 7, 7}));
+}
+
+TEST_F(IR_InterpreterTest, WorkgroupMemoryAndBarrier) {
+    std::vector<uint32_t> out(8, 0);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+var<workgroup> shared_values : array<u32, 4>;
+
+@compute @workgroup_size(4)
+fn main(@builtin(local_invocation_index) local : u32,
+        @builtin(workgroup_id) group : vec3u) {
+  shared_values[local] = local + group.x * 10;
+  workgroupBarrier();
+  // Reverse the values of the workgroup.
+  out[group.x * 4 + local] = shared_values[3 - local];
+}
+)",
+                  {2, 1, 1}, {&out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{3, 2, 1, 0, 13, 12, 11, 10}));
+}
+
+TEST_F(IR_InterpreterTest, BarriersInLoopAndFunction) {
+    std::vector<uint32_t> out(8, 0);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+var<workgroup> values : array<u32, 4>;
+
+fn sync() {
+  workgroupBarrier();
+}
+
+// Inclusive prefix sum of the workgroup values.
+@compute @workgroup_size(4)
+fn main(@builtin(local_invocation_index) local : u32,
+        @builtin(workgroup_id) group : vec3u) {
+  values[local] = local + 1 + group.x;
+  for (var step = 1u; step < 4u; step *= 2u) {
+    sync();
+    var x = 0u;
+    if (local >= step) {
+      x = values[local - step];
+    }
+    sync();
+    values[local] += x;
+  }
+  sync();
+  out[group.x * 4 + local] = values[local];
+}
+)",
+                  {2, 1, 1}, {&out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{1, 3, 6, 10, 2, 5, 9, 14}));
+}
+
+TEST_F(IR_InterpreterTest, ReturnFromNestedControlFlow) {
+    std::vector<uint32_t> out(3, 0);
+    EXPECT_EQ(Run(R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+fn find(n : u32) -> u32 {
+  loop {
+    for (var i = 0u; i < 10u; i++) {
+      switch (i) {
+        case 7u: {
+          if (n == 20u) {
+            return i * 10u;
+          }
+        }
+        default: {}
+      }
+      if (i == n) {
+        return i;
+      }
+    }
+    return 99u;
+  }
+}
+
+@compute @workgroup_size(1)
+fn main() {
+  out[0] = find(3);
+  out[1] = find(1);
+  out[2] = find(20);
+}
+)",
+                  {1, 1, 1}, {&out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{3, 1, 70}));
+}
+
+TEST_F(IR_InterpreterTest, Atomics) {
+    std::vector<uint32_t> out(2, 0);
+    EXPECT_EQ(Run(R"(
+struct Counters {
+  sum : atomic<u32>,
+  max : atomic<u32>,
+}
+@group(0) @binding(0) var<storage, read_write> counters : Counters;
+
+@compute @workgroup_size(8)
+fn main(@builtin(global_invocation_id) id : vec3u) {
+  atomicAdd(&counters.sum, id.x);
+  atomicMax(&counters.max, id.x);
+}
+)",
+                  {4, 1, 1}, {&out}),
+              "");
+    EXPECT_EQ(out, (std::vector<uint32_t>{496, 31}));
+}
+
+TEST_F(IR_InterpreterTest, RepeatedDispatches) {
+    Source::File file{"test", R"(
+@group(0) @binding(0) var<storage, read_write> out : array<u32>;
+
+@compute @workgroup_size(2)
+fn add(@builtin(global_invocation_id) id : vec3u) {
+  out[id.x] += 1;
+}
+
+@compute @workgroup_size(2)
+fn twice(@builtin(global_invocation_id) id : vec3u) {
+  out[id.x] *= 2;
+}
+)"};
+    auto module = wgsl::reader::WgslToIR(&file);
+    ASSERT_EQ(module, Success) << module.Failure().reason.Str();
+
+    Interpreter interpreter(module.Get());
+    auto bind = [&](std::vector<uint32_t>& buffer) {
+        interpreter.BindBuffer(BindingPoint{0, 0},
+                               Slice<uint8_t>(reinterpret_cast<uint8_t*>(buffer.data()),
+                                              buffer.size() * sizeof(uint32_t)));
+    };
+
+    std::vector<uint32_t> a(4, 1);
+    std::vector<uint32_t> b(4, 5);
+    bind(a);
+    EXPECT_EQ(interpreter.Dispatch("add", {2, 1, 1}), Success);
+    EXPECT_EQ(interpreter.Dispatch("twice", {2, 1, 1}), Success);
+    bind(b);
+    EXPECT_EQ(interpreter.Dispatch("add", {1, 1, 1}), Success);
+    EXPECT_NE(interpreter.Dispatch("main", {1, 1, 1}), Success);
+    EXPECT_EQ(a, (std::vector<uint32_t>{4, 4, 4, 4}));
+    EXPECT_EQ(b, (std::vector<uint32_t>{6, 6, 5, 5}));
+}
+
+TEST_F(IR_InterpreterTest, MissingEntryPoint) {
+    EXPECT_EQ(Run(R"(
+@compute @workgroup_size(1)
+fn other() {}
+)",
+                  {1, 1, 1}, {}),
+              "error: compute entry point 'main' not found");
+}
+
+}  // namespace
+}  // namespace tint::core::ir::interpreter
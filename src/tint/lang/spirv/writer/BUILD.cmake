@@ -211,6 +211,12 @@ tint_target_add_external_dependencies(tint_lang_spirv_writer_bench bench
   "google-benchmark"
 )
 
+if(TINT_BUILD_SPV_READER OR TINT_BUILD_SPV_WRITER)
+  tint_target_add_external_dependencies(tint_lang_spirv_writer_bench bench
+    "spirv-headers"
+  )
+endif(TINT_BUILD_SPV_READER OR TINT_BUILD_SPV_WRITER)
+
 if(TINT_BUILD_SPV_WRITER)
   tint_target_add_dependencies(tint_lang_spirv_writer_bench bench
     tint_lang_spirv_writer
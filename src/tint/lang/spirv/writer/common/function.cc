@@ -27,19 +27,25 @@
 
 #include "src/tint/lang/spirv/writer/common/function.h"
 
+#include <utility>
+
 namespace tint::spirv::writer {
 
 Function::Function() : declaration_(Instruction{spv::Op::OpNop, {}}), label_op_(Operand(0u)) {}
 
-Function::Function(const Instruction& declaration,
-                   const Operand& label_op,
-                   const InstructionList& params)
-    : declaration_(declaration), label_op_(label_op), params_(params) {}
+Function::Function(Instruction declaration, Operand label_op, InstructionList params)
+    : declaration_(std::move(declaration)),
+      label_op_(std::move(label_op)),
+      params_(std::move(params)) {}
 
 Function::Function(const Function& other) = default;
 
+Function::Function(Function&& other) noexcept = default;
+
 Function& Function::operator=(const Function& other) = default;
 
+Function& Function::operator=(Function&& other) noexcept = default;
+
 Function::~Function() = default;
 
 void Function::iterate(std::function<void(const Instruction&)> cb) const {
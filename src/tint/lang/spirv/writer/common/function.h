@@ -29,6 +29,7 @@
 #define SRC_TINT_LANG_SPIRV_WRITER_COMMON_FUNCTION_H_
 
 #include <functional>
+#include <utility>
 
 #include "src/tint/lang/spirv/writer/common/instruction.h"
 
@@ -45,16 +46,21 @@ class Function {
     /// @param declaration the function declaration
     /// @param label_op the operand for function's entry block label
     /// @param params the function parameters
-    Function(const Instruction& declaration,
-             const Operand& label_op,
-             const InstructionList& params);
+    Function(Instruction declaration, Operand label_op, InstructionList params);
     /// Copy constructor
     /// @param other the function to copy
     Function(const Function& other);
+    /// Move constructor
+    /// @param other the function to move
+    Function(Function&& other) noexcept;
     /// Copy assignment operator
     /// @param other the function to copy
     /// @returns the new Function
     Function& operator=(const Function& other);
+    /// Move assignment operator
+    /// @param other the function to move
+    /// @returns the new Function
+    Function& operator=(Function&& other) noexcept;
     /// Destructor
     ~Function();
 
@@ -71,16 +77,16 @@ class Function {
     /// Adds an instruction to the instruction list
     /// @param op the op to set
     /// @param operands the operands for the instruction
-    void push_inst(spv::Op op, const OperandList& operands) {
-        instructions_.push_back(Instruction{op, operands});
+    void push_inst(spv::Op op, OperandList operands) {
+        instructions_.push_back(Instruction{op, std::move(operands)});
     }
     /// @returns the instruction list
     const InstructionList& instructions() const { return instructions_; }
 
     /// Adds a variable to the variable list
     /// @param operands the operands for the variable
-    void push_var(const OperandList& operands) {
-        vars_.push_back(Instruction{spv::Op::OpVariable, operands});
+    void push_var(OperandList operands) {
+        vars_.push_back(Instruction{spv::Op::OpVariable, std::move(operands)});
     }
     /// @returns the variable list
     const InstructionList& variables() const { return vars_; }
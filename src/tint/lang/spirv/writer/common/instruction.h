@@ -44,10 +44,16 @@ class Instruction {
     Instruction(spv::Op op, OperandList operands);
     /// Copy Constructor
     Instruction(const Instruction&);
+    /// Move Constructor
+    Instruction(Instruction&&) noexcept;
     /// Copy assignment operator
     /// @param other the instruction to copy
     /// @returns the new Instruction
     Instruction& operator=(const Instruction& other);
+    /// Move assignment operator
+    /// @param other the instruction to move
+    /// @returns the new Instruction
+    Instruction& operator=(Instruction&& other) noexcept;
     /// Destructor
     ~Instruction();
 
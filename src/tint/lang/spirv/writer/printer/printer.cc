@@ -217,7 +217,7 @@ class Printer {
         writer.WriteHeader(module_.IdBound(), kWriterVersion);
         writer.WriteModule(module_);
         module_.Code() = std::move(writer.Result());
-        return module_;
+        return std::move(module_);
     }
 
   private:
@@ -424,14 +424,14 @@ class Printer {
                     for (uint32_t i = 0; i < vec->Width(); i++) {
                         operands.push_back(Constant(constant->Index(i)));
                     }
-                    module_.PushType(spv::Op::OpConstantComposite, operands);
+                    module_.PushType(spv::Op::OpConstantComposite, std::move(operands));
                 },
                 [&](const core::type::Matrix* mat) {
                     OperandList operands = {Type(ty), id};
                     for (uint32_t i = 0; i < mat->columns(); i++) {
                         operands.push_back(Constant(constant->Index(i)));
                     }
-                    module_.PushType(spv::Op::OpConstantComposite, operands);
+                    module_.PushType(spv::Op::OpConstantComposite, std::move(operands));
                 },
                 [&](const core::type::Array* arr) {
                     TINT_ASSERT(arr->ConstantCount());
@@ -439,14 +439,14 @@ class Printer {
                     for (uint32_t i = 0; i < arr->ConstantCount(); i++) {
                         operands.push_back(Constant(constant->Index(i)));
                     }
-                    module_.PushType(spv::Op::OpConstantComposite, operands);
+                    module_.PushType(spv::Op::OpConstantComposite, std::move(operands));
                 },
                 [&](const core::type::Struct* str) {
                     OperandList operands = {Type(ty), id};
                     for (uint32_t i = 0; i < str->Members().Length(); i++) {
                         operands.push_back(Constant(constant->Index(i)));
                     }
-                    module_.PushType(spv::Op::OpConstantComposite, operands);
+                    module_.PushType(spv::Op::OpConstantComposite, std::move(operands));
                 },  //
                 TINT_ICE_ON_NO_MATCH);
             return id;
@@ -729,7 +729,7 @@ class Printer {
             OperandList operands = {func_ty_id, return_type_id};
             operands.insert(operands.end(), function_type.param_type_ids.begin(),
                             function_type.param_type_ids.end());
-            module_.PushType(spv::Op::OpTypeFunction, operands);
+            module_.PushType(spv::Op::OpTypeFunction, std::move(operands));
             return func_ty_id;
         });
 
@@ -740,14 +740,14 @@ class Printer {
 
         // Create a function that we will add instructions to.
         auto entry_block = module_.NextId();
-        current_function_ = Function(decl, entry_block, std::move(params));
+        current_function_ = Function(std::move(decl), entry_block, std::move(params));
         TINT_DEFER(current_function_ = Function());
 
         // Emit the body of the function.
         EmitBlock(func->Block());
 
         // Add the function to the module.
-        module_.PushFunction(current_function_);
+        module_.PushFunction(std::move(current_function_));
     }
 
     /// Emit entry point declarations for a function.
@@ -817,7 +817,7 @@ class Printer {
             }
         }
 
-        module_.PushEntryPoint(spv::Op::OpEntryPoint, operands);
+        module_.PushEntryPoint(spv::Op::OpEntryPoint, std::move(operands));
     }
 
     /// Emit the root block.
@@ -930,7 +930,7 @@ class Printer {
                     TINT_ASSERT(t->Args().Length() == 1u);
                     OperandList operands;
                     operands.push_back(Value(t->Args()[0]));
-                    current_function_.push_inst(spv::Op::OpReturnValue, operands);
+                    current_function_.push_inst(spv::Op::OpReturnValue, std::move(operands));
                 } else {
                     current_function_.push_inst(spv::Op::OpReturn, {});
                 }
@@ -1358,7 +1358,7 @@ class Printer {
         for (auto* arg : builtin->Args()) {
             operands.push_back(Value(arg));
         }
-        current_function_.push_inst(op, operands);
+        current_function_.push_inst(op, std::move(operands));
     }
 
     /// Emit a builtin function call instruction.
@@ -1712,7 +1712,7 @@ class Printer {
         }
 
         // Emit the instruction.
-        current_function_.push_inst(op, operands);
+        current_function_.push_inst(op, std::move(operands));
     }
 
     /// Emit a construct instruction.
@@ -1921,7 +1921,7 @@ class Printer {
         // Emit the OpSelectionMerge and OpSwitch instructions.
         current_function_.push_inst(spv::Op::OpSelectionMerge,
                                     {merge_label, U32Operand(SpvSelectionControlMaskNone)});
-        current_function_.push_inst(spv::Op::OpSwitch, switch_operands);
+        current_function_.push_inst(spv::Op::OpSwitch, std::move(switch_operands));
 
         // Emit the cases.
         for (auto& c : swtch->Cases()) {
@@ -1944,7 +1944,7 @@ class Printer {
         for (auto idx : swizzle->Indices()) {
             operands.push_back(idx);
         }
-        current_function_.push_inst(spv::Op::OpVectorShuffle, operands);
+        current_function_.push_inst(spv::Op::OpVectorShuffle, std::move(operands));
     }
 
     /// Emit a store instruction.
@@ -2000,7 +2000,7 @@ class Printer {
         for (auto* arg : call->Args()) {
             operands.push_back(Value(arg));
         }
-        current_function_.push_inst(spv::Op::OpFunctionCall, operands);
+        current_function_.push_inst(spv::Op::OpFunctionCall, std::move(operands));
     }
 
     /// Emit IO attributes.
@@ -2091,7 +2091,7 @@ class Printer {
                 } else {
                     operands.push_back(ConstantNull(store_ty));
                 }
-                module_.PushType(spv::Op::OpVariable, operands);
+                module_.PushType(spv::Op::OpVariable, std::move(operands));
                 break;
             }
             case core::AddressSpace::kPushConstant: {
@@ -2151,7 +2151,7 @@ class Printer {
                     // zero-initialize the workgroup variable using an null constant initializer.
                     operands.push_back(ConstantNull(store_ty));
                 }
-                module_.PushType(spv::Op::OpVariable, operands);
+                module_.PushType(spv::Op::OpVariable, std::move(operands));
                 break;
             }
             default: {
@@ -66,6 +66,23 @@ void Module::AddGlobalDeclaration(const tint::ast::Node* decl) {
     global_declarations_.Push(decl);
 }
 
+void Module::ReorderGlobalDeclarations(VectorRef<const Node*> decls) {
+    TINT_ASSERT(decls.Length() == global_declarations_.Length());
+
+    type_decls_.Clear();
+    functions_.Clear();
+    global_variables_.Clear();
+    diagnostic_directives_.Clear();
+    enables_.Clear();
+    requires_.Clear();
+    const_asserts_.Clear();
+
+    global_declarations_ = std::move(decls);
+    for (auto* decl : global_declarations_) {
+        BinGlobalDeclaration(decl);
+    }
+}
+
 void Module::BinGlobalDeclaration(const tint::ast::Node* decl) {
     Switch(
         decl,  //
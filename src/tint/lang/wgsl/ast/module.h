@@ -84,6 +84,10 @@ class Module final : public Castable<Module, Node> {
     /// @param decl the declaration to add
     void AddGlobalDeclaration(const tint::ast::Node* decl);
 
+    /// Replaces the global declarations of the module with @p decls.
+    /// @param decls the new global declarations, which must be a reordering of the current ones
+    void ReorderGlobalDeclarations(VectorRef<const Node*> decls);
+
     /// @returns the global variables for the module
     const auto& GlobalVariables() const { return global_variables_; }
 
@@ -31,7 +31,6 @@
 
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::AddEmptyEntryPoint);
 
@@ -55,24 +54,18 @@ AddEmptyEntryPoint::AddEmptyEntryPoint() = default;
 
 AddEmptyEntryPoint::~AddEmptyEntryPoint() = default;
 
-Transform::ApplyResult AddEmptyEntryPoint::Apply(const Program& src,
-                                                 const DataMap&,
-                                                 DataMap&) const {
-    if (!ShouldRun(src)) {
-        return SkipTransform;
+bool AddEmptyEntryPoint::ApplyFused(program::CloneContext& ctx, const DataMap&, DataMap&) const {
+    if (!ShouldRun(*ctx.src)) {
+        return false;
     }
 
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
-
+    ProgramBuilder& b = *ctx.dst;
     b.Func(b.Symbols().New("unused_entry_point"), {}, b.ty.void_(), {},
            tint::Vector{
                b.Stage(PipelineStage::kCompute),
                b.WorkgroupSize(1_i),
            });
-
-    ctx.Clone();
-    return resolver::Resolve(b);
+    return true;
 }
 
 }  // namespace tint::ast::transform
@@ -33,17 +33,17 @@
 namespace tint::ast::transform {
 
 /// Add an empty entry point to the module, if no other entry points exist.
-class AddEmptyEntryPoint final : public Castable<AddEmptyEntryPoint, Transform> {
+class AddEmptyEntryPoint final : public Castable<AddEmptyEntryPoint, FusableTransform> {
   public:
     /// Constructor
     AddEmptyEntryPoint();
     /// Destructor
     ~AddEmptyEntryPoint() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc FusableTransform::ApplyFused
+    bool ApplyFused(program::CloneContext& ctx,
+                    const DataMap& inputs,
+                    DataMap& outputs) const override;
 };
 
 }  // namespace tint::ast::transform
@@ -33,17 +33,18 @@
 namespace tint::ast::transform {
 
 /// Disable uniformity analysis for the program.
-class DisableUniformityAnalysis final : public Castable<DisableUniformityAnalysis, Transform> {
+class DisableUniformityAnalysis final
+    : public Castable<DisableUniformityAnalysis, FusableTransform> {
   public:
     /// Constructor
     DisableUniformityAnalysis();
     /// Destructor
     ~DisableUniformityAnalysis() override;
 
-    /// @copydoc Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const DataMap& inputs,
-                      DataMap& outputs) const override;
+    /// @copydoc FusableTransform::ApplyFused
+    bool ApplyFused(program::CloneContext& ctx,
+                    const DataMap& inputs,
+                    DataMap& outputs) const override;
 };
 
 }  // namespace tint::ast::transform
@@ -36,7 +36,6 @@
 #include "src/tint/lang/core/type/bool.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/utils/rtti/switch.h"
 
 using namespace tint::core::fluent_types;  // NOLINT
@@ -52,7 +51,7 @@ struct State {
         kDisallowed,
     };
 
-    const ast::Expression* Constant(const core::constant::Value* c) {
+    const ast::Expression* Constant(const core::constant::Value* c) const {
         auto composite = [&](Splat splat) -> const ast::Expression* {
             auto ty = FoldConstants::CreateASTTypeFor(ctx, c->Type());
             if (c->AllZero()) {
@@ -85,39 +84,38 @@ struct State {
             TINT_ICE_ON_NO_MATCH);
     }
 
-    Transform::ApplyResult Run() {
-        ctx.ReplaceAll([&](const Expression* expr) -> const Expression* {
-            auto& sem = ctx.src->Sem();
-            auto* ve = sem.Get<sem::ValueExpression>(expr);
+    const Expression* Fold(const Expression* expr) const {
+        auto& sem = ctx.src->Sem();
+        auto* ve = sem.Get<sem::ValueExpression>(expr);
 
-            // No value expression SEM node found
-            if (!ve) {
-                return nullptr;
-            }
+        // No value expression SEM node found
+        if (!ve) {
+            return nullptr;
+        }
 
-            auto* cv = ve->ConstantValue();
+        auto* cv = ve->ConstantValue();
 
-            // No constant value for this expression
-            if (!cv) {
-                return nullptr;
-            }
+        // No constant value for this expression
+        if (!cv) {
+            return nullptr;
+        }
 
-            if (cv->Type()->HoldsAbstract() && !cv->Type()->is_float_scalar() &&
-                !cv->Type()->is_signed_integer_scalar() &&
-                !cv->Type()->is_unsigned_integer_scalar()) {
-                return nullptr;
-            }
+        if (cv->Type()->HoldsAbstract() && !cv->Type()->is_float_scalar() &&
+            !cv->Type()->is_signed_integer_scalar() && !cv->Type()->is_unsigned_integer_scalar()) {
+            return nullptr;
+        }
 
-            return Constant(cv);
-        });
+        return Constant(cv);
+    }
 
-        ctx.Clone();
-        return resolver::Resolve(b);
+    void Run() {
+        // The replacer is only called when the program is cloned, after this State is gone, so it
+        // holds its own copy of the State.
+        ctx.ReplaceAll([state = *this](const Expression* expr) { return state.Fold(expr); });
     }
 
-    const Program& src;
-    ProgramBuilder b;
-    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
+    program::CloneContext& ctx;
+    ProgramBuilder& b = *ctx.dst;
 };
 
 }  // namespace
@@ -126,9 +124,9 @@ FoldConstants::FoldConstants() = default;
 
 FoldConstants::~FoldConstants() = default;
 
-Transform::ApplyResult FoldConstants::Apply(const Program& src, const DataMap&, DataMap&) const {
-    State s{src, {}};
-    return s.Run();
+bool FoldConstants::ApplyFused(program::CloneContext& ctx, const DataMap&, DataMap&) const {
+    State{ctx}.Run();
+    return true;
 }
 
 }  // namespace tint::ast::transform
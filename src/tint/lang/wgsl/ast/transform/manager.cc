@@ -26,10 +26,15 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "src/tint/lang/wgsl/ast/transform/manager.h"
+
+#include <optional>
+#include <utility>
+
 #include "src/tint/lang/wgsl/ast/transform/transform.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
 #include "src/tint/lang/wgsl/resolver/resolve.h"
+#include "src/tint/utils/containers/vector.h"
 
 /// If set to 1 then the transform::Manager will dump the WGSL of the program
 /// before and after each transform. Helpful for debugging bad output.
@@ -70,19 +75,68 @@ Program Manager::Run(const Program& program_in, const DataMap& inputs, DataMap&
 
     TINT_IF_PRINT_PROGRAM(print_program("Input of", nullptr));
 
-    for (const auto& transform : transforms_) {
-        if (auto result = transform->Apply(*program, inputs, outputs)) {
+    for (size_t i = 0; i < transforms_.size();) {
+        const Transform* transform = transforms_[i].get();
+        std::optional<Program> result;
+
+        if (transform->Is<FusableTransform>()) {
+            // Register the changes of all the adjacent fusable transforms with a single clone
+            // context, so the program is only cloned and resolved once for the whole run.
+            ProgramBuilder b;
+            program::CloneContext ctx{&b, program, /* auto_clone_symbols */ true};
+            bool changed = false;
+            // The end of the global declarations added by each of the fused transforms.
+            Vector<size_t, 8> decl_ends;
+            for (; i < transforms_.size(); i++) {
+                auto* fusable = transforms_[i]->As<FusableTransform>();
+                if (!fusable) {
+                    break;
+                }
+                if (fusable->ApplyFused(ctx, inputs, outputs)) {
+                    changed = true;
+                    transform = fusable;
+                } else {
+                    TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << fusable->TypeInfo().name
+                                                    << "\n");
+                }
+                decl_ends.Push(b.AST().GlobalDeclarations().Length());
+            }
+            if (changed) {
+                // Run one after another, each transform would place the declarations it adds
+                // before those of the previous transforms. Reorder them to match.
+                if (decl_ends.Length() > 1 && decl_ends.Front() != decl_ends.Back()) {
+                    auto& decls = b.AST().GlobalDeclarations();
+                    Vector<const Node*, 64> reordered;
+                    for (size_t t = decl_ends.Length(); t > 0; t--) {
+                        size_t begin = t > 1 ? decl_ends[t - 2] : 0;
+                        for (size_t d = begin; d < decl_ends[t - 1]; d++) {
+                            reordered.Push(decls[d]);
+                        }
+                    }
+                    b.AST().ReorderGlobalDeclarations(std::move(reordered));
+                }
+                ctx.Clone();
+                result = resolver::Resolve(b);
+            }
+        } else {
+            result = transform->Apply(*program, inputs, outputs);
+            if (!result) {
+                TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << transform->TypeInfo().name
+                                                << "\n");
+            }
+            i++;
+        }
+
+        if (result) {
             output.emplace(std::move(result.value()));
             program = &output.value();
 
             if (!program->IsValid()) {
-                TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform.get()));
+                TINT_IF_PRINT_PROGRAM(print_program("Invalid output of", transform));
                 break;
             }
 
-            TINT_IF_PRINT_PROGRAM(print_program("Output of", transform.get()));
-        } else {
-            TINT_IF_PRINT_PROGRAM(std::cout << "Skipped " << transform->TypeInfo().name << "\n");
+            TINT_IF_PRINT_PROGRAM(print_program("Output of", transform));
         }
     }
 
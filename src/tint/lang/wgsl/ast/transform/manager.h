@@ -42,6 +42,8 @@ namespace tint::ast::transform {
 /// The inner transforms will execute in the appended order.
 /// If any inner transform fails the manager will return immediately and
 /// the error can be retrieved with the Output's diagnostics.
+/// Runs of adjacent FusableTransforms are applied to a single clone of the
+/// program, which is only resolved once at the end of the run.
 class Manager {
   public:
     /// Constructor
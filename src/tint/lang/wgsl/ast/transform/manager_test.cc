@@ -56,6 +56,27 @@ class AST_AddFunction final : public ast::transform::Transform {
     }
 };
 
+class AST_FusedAddFunction final : public ast::transform::FusableTransform {
+  public:
+    AST_FusedAddFunction(const char* name, const Program** src) : name_(name), src_(src) {}
+
+    bool ApplyFused(program::CloneContext& ctx, const DataMap&, DataMap&) const override {
+        *src_ = ctx.src;
+        ctx.dst->Func(ctx.dst->Sym(name_), {}, ctx.dst->ty.void_(), {});
+        return true;
+    }
+
+  private:
+    const char* const name_;
+    const Program** const src_;
+};
+
+class AST_FusedNoOp final : public ast::transform::FusableTransform {
+    bool ApplyFused(program::CloneContext&, const DataMap&, DataMap&) const override {
+        return false;
+    }
+};
+
 Program MakeAST() {
     ProgramBuilder b;
     b.Func(b.Sym("main"), {}, b.ty.void_(), {});
@@ -77,5 +98,91 @@ TEST_F(TransformManagerTest, AST_AlwaysClone) {
     EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
 }
 
+// Test that adjacent fusable transforms are applied to the same input program.
+TEST_F(TransformManagerTest, AST_FusedTransformsShareClone) {
+    Program ast = MakeAST();
+
+    const Program* src_a = nullptr;
+    const Program* src_b = nullptr;
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_FusedAddFunction>("a", &src_a);
+    manager.Add<AST_FusedNoOp>();
+    manager.Add<AST_FusedAddFunction>("b", &src_b);
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_EQ(src_a, &ast);
+    EXPECT_EQ(src_b, &ast);
+    ASSERT_EQ(result.AST().Functions().Length(), 3u);
+    EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "b");
+    EXPECT_EQ(result.AST().Functions()[1]->name->symbol.Name(), "a");
+    EXPECT_EQ(result.AST().Functions()[2]->name->symbol.Name(), "main");
+}
+
+// Test that fused transforms produce the same declaration order as running them one after another.
+TEST_F(TransformManagerTest, AST_FusedTransformsMatchSequentialOrder) {
+    Program ast = MakeAST();
+
+    const Program* src_a = nullptr;
+    const Program* src_b = nullptr;
+    Manager fused;
+    DataMap fused_outputs;
+    fused.Add<AST_FusedAddFunction>("a", &src_a);
+    fused.Add<AST_FusedAddFunction>("b", &src_b);
+    auto fused_result = fused.Run(ast, {}, fused_outputs);
+    EXPECT_TRUE(fused_result.IsValid()) << fused_result.Diagnostics();
+
+    DataMap outputs;
+    auto after_a = AST_FusedAddFunction("a", &src_a).Apply(ast, {}, outputs);
+    ASSERT_TRUE(after_a.has_value());
+    auto after_b = AST_FusedAddFunction("b", &src_b).Apply(*after_a, {}, outputs);
+    ASSERT_TRUE(after_b.has_value());
+    EXPECT_TRUE(after_b->IsValid()) << after_b->Diagnostics();
+
+    auto& fused_functions = fused_result.AST().Functions();
+    auto& sequential_functions = after_b->AST().Functions();
+    ASSERT_EQ(fused_functions.Length(), sequential_functions.Length());
+    for (size_t i = 0; i < fused_functions.Length(); i++) {
+        EXPECT_EQ(fused_functions[i]->name->symbol.Name(),
+                  sequential_functions[i]->name->symbol.Name());
+    }
+}
+
+// Test that a non-fusable transform splits a run of fusable transforms.
+TEST_F(TransformManagerTest, AST_FusedTransformsSplitByTransform) {
+    Program ast = MakeAST();
+
+    const Program* src_a = nullptr;
+    const Program* src_b = nullptr;
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_FusedAddFunction>("a", &src_a);
+    manager.Add<AST_AddFunction>();
+    manager.Add<AST_FusedAddFunction>("b", &src_b);
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_EQ(src_a, &ast);
+    EXPECT_NE(src_b, &ast);
+    EXPECT_EQ(result.AST().Functions().Length(), 4u);
+}
+
+// Test that an AST program is always cloned, even if all fusable transforms are skipped.
+TEST_F(TransformManagerTest, AST_FusedAlwaysClone) {
+    Program ast = MakeAST();
+
+    Manager manager;
+    DataMap outputs;
+    manager.Add<AST_FusedNoOp>();
+    manager.Add<AST_FusedNoOp>();
+
+    auto result = manager.Run(ast, {}, outputs);
+    EXPECT_TRUE(result.IsValid()) << result.Diagnostics();
+    EXPECT_NE(result.ID(), ast.ID());
+    ASSERT_EQ(result.AST().Functions().Length(), 1u);
+    EXPECT_EQ(result.AST().Functions()[0]->name->symbol.Name(), "main");
+}
+
 }  // namespace
 }  // namespace tint::ast::transform
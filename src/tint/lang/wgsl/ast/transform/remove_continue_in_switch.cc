@@ -35,7 +35,6 @@
 #include "src/tint/lang/wgsl/ast/transform/get_insertion_point.h"
 #include "src/tint/lang/wgsl/program/clone_context.h"
 #include "src/tint/lang/wgsl/program/program_builder.h"
-#include "src/tint/lang/wgsl/resolver/resolve.h"
 #include "src/tint/lang/wgsl/sem/block_statement.h"
 #include "src/tint/lang/wgsl/sem/loop_statement.h"
 #include "src/tint/lang/wgsl/sem/switch_statement.h"
@@ -49,12 +48,13 @@ namespace tint::ast::transform {
 /// PIMPL state for the transform
 struct RemoveContinueInSwitch::State {
     /// Constructor
-    /// @param program the source program
-    explicit State(const Program& program) : src(program) {}
+    /// @param context the clone context
+    explicit State(program::CloneContext& context) : ctx(context) {}
 
     /// Runs the transform
-    /// @returns the new program or SkipTransform if the transform is not required
-    ApplyResult Run() {
+    /// @returns true if the transform registered changes with the clone context, false if the
+    /// transform is not required
+    bool Run() {
         // First collect all switch statements within loops that contain a continue statement.
         for (auto* node : src.ASTNodes().Objects()) {
             auto* cont = node->As<ast::ContinueStatement>();
@@ -77,7 +77,7 @@ struct RemoveContinueInSwitch::State {
         }
 
         if (switch_stmts.IsEmpty()) {
-            return SkipTransform;
+            return false;
         }
 
         // For each switch statement:
@@ -133,17 +133,16 @@ struct RemoveContinueInSwitch::State {
             }
         }
 
-        ctx.Clone();
-        return resolver::Resolve(b);
+        return true;
     }
 
   private:
+    /// The clone context
+    program::CloneContext& ctx;
     /// The source program
-    const Program& src;
+    const Program& src = *ctx.src;
     /// The target program builder
-    ProgramBuilder b;
-    /// The clone context
-    program::CloneContext ctx = {&b, &src, /* auto_clone_symbols */ true};
+    ProgramBuilder& b = *ctx.dst;
     /// Alias to src.sem
     const sem::Info& sem = src.Sem();
 
@@ -189,11 +188,10 @@ struct RemoveContinueInSwitch::State {
 RemoveContinueInSwitch::RemoveContinueInSwitch() = default;
 RemoveContinueInSwitch::~RemoveContinueInSwitch() = default;
 
-ast::transform::Transform::ApplyResult RemoveContinueInSwitch::Apply(
-    const Program& src,
-    const ast::transform::DataMap&,
-    ast::transform::DataMap&) const {
-    State state(src);
+bool RemoveContinueInSwitch::ApplyFused(program::CloneContext& ctx,
+                                        const ast::transform::DataMap&,
+                                        ast::transform::DataMap&) const {
+    State state(ctx);
     return state.Run();
 }
 
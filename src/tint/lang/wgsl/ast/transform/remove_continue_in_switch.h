@@ -38,7 +38,7 @@ namespace tint::ast::transform {
 ///  * FXC "error X3708: continue cannot be used in a switch". See crbug.com/tint/1080.
 ///  * MSL and GLSL invalid code-gen. See crbug.com/tint/2039.
 class RemoveContinueInSwitch final
-    : public Castable<RemoveContinueInSwitch, ast::transform::Transform> {
+    : public Castable<RemoveContinueInSwitch, ast::transform::FusableTransform> {
   public:
     /// Constructor
     RemoveContinueInSwitch();
@@ -46,10 +46,10 @@ class RemoveContinueInSwitch final
     /// Destructor
     ~RemoveContinueInSwitch() override;
 
-    /// @copydoc ast::transform::Transform::Apply
-    ApplyResult Apply(const Program& program,
-                      const ast::transform::DataMap& inputs,
-                      ast::transform::DataMap& outputs) const override;
+    /// @copydoc ast::transform::FusableTransform::ApplyFused
+    bool ApplyFused(program::CloneContext& ctx,
+                    const ast::transform::DataMap& inputs,
+                    ast::transform::DataMap& outputs) const override;
 
   private:
     struct State;
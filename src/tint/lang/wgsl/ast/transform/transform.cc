@@ -47,6 +47,7 @@
 using namespace tint::core::fluent_types;  // NOLINT
 
 TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::Transform);
+TINT_INSTANTIATE_TYPEINFO(tint::ast::transform::FusableTransform);
 
 namespace tint::ast::transform {
 
@@ -68,6 +69,21 @@ Output Transform::Run(const Program& src, const DataMap& data /* = {} */) const
     return output;
 }
 
+FusableTransform::FusableTransform() = default;
+FusableTransform::~FusableTransform() = default;
+
+Transform::ApplyResult FusableTransform::Apply(const Program& src,
+                                               const DataMap& inputs,
+                                               DataMap& outputs) const {
+    ProgramBuilder b;
+    program::CloneContext ctx{&b, &src, /* auto_clone_symbols */ true};
+    if (!ApplyFused(ctx, inputs, outputs)) {
+        return SkipTransform;
+    }
+    ctx.Clone();
+    return resolver::Resolve(b);
+}
+
 void Transform::RemoveStatement(program::CloneContext& ctx, const Statement* stmt) {
     auto* sem = ctx.src->Sem().Get(stmt);
     if (auto* block = tint::As<sem::BlockStatement>(sem->Parent())) {
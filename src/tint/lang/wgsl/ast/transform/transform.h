@@ -112,6 +112,44 @@ class Transform : public Castable<Transform> {
     static void RemoveStatement(program::CloneContext& ctx, const Statement* stmt);
 };
 
+/// Interface for Program transforms that can share a single program clone with other transforms.
+/// A FusableTransform does not clone or resolve the program itself. Instead it registers its
+/// changes with a CloneContext, which the Manager shares between a run of adjacent
+/// FusableTransforms. The Manager then clones and resolves the program once for the whole run,
+/// instead of once per transform.
+/// As all the transforms of a run see the same input program, a FusableTransform must only
+/// depend on properties of the program that the other fusable transforms do not change, and it
+/// must not register CloneContext replacements that may conflict with those of another
+/// FusableTransform.
+class FusableTransform : public Castable<FusableTransform, Transform> {
+  public:
+    /// Constructor
+    FusableTransform();
+    /// Destructor
+    ~FusableTransform() override;
+
+    /// Runs the transform on its own, by calling ApplyFused() then cloning and resolving the
+    /// program.
+    /// @param program the input program
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns a transformed program, or std::nullopt if the transform didn't need to run.
+    ApplyResult Apply(const Program& program,
+                      const DataMap& inputs,
+                      DataMap& outputs) const override;
+
+    /// Registers the changes of the transform with @p ctx, without cloning the program.
+    /// @param ctx the clone context shared by the fused transforms. `ctx.src` is the input
+    /// program, and must not be cloned by the transform.
+    /// @param inputs optional extra transform-specific input data
+    /// @param outputs optional extra transform-specific output data
+    /// @returns true if the transform registered changes, false if the transform didn't need to
+    /// run.
+    virtual bool ApplyFused(program::CloneContext& ctx,
+                            const DataMap& inputs,
+                            DataMap& outputs) const = 0;
+};
+
 }  // namespace tint::ast::transform
 
 #endif  // SRC_TINT_LANG_WGSL_AST_TRANSFORM_TRANSFORM_H_
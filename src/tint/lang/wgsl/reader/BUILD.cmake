@@ -132,6 +132,7 @@ if(TINT_BUILD_WGSL_READER)
 # Condition: TINT_BUILD_WGSL_READER
 ################################################################################
 tint_add_target(tint_lang_wgsl_reader_bench bench
+  lang/wgsl/reader/lexer_bench.cc
   lang/wgsl/reader/reader_bench.cc
 )
 
@@ -170,6 +171,7 @@ tint_target_add_external_dependencies(tint_lang_wgsl_reader_bench bench
 if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_lang_wgsl_reader_bench bench
     tint_lang_wgsl_reader
+    tint_lang_wgsl_reader_parser
   )
 endif(TINT_BUILD_WGSL_READER)
 
@@ -28,6 +28,8 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 #define SRC_TINT_LANG_WGSL_READER_OPTIONS_H_
 
+#include <cstdint>
+
 #include "src/tint/lang/wgsl/common/allowed_features.h"
 #include "src/tint/lang/wgsl/common/validation_mode.h"
 #include "src/tint/utils/reflection/reflection.h"
@@ -42,8 +44,12 @@ struct Options {
     /// The validation mode to use.
     ValidationMode mode = ValidationMode::kFull;
 
+    /// The maximum number of threads used to lex the source, including the calling thread. Large
+    /// sources are split at line boundaries and the pieces are lexed concurrently.
+    uint32_t lexer_thread_count = 1;
+
     /// Reflect the fields of this class so that it can be used by tint::ForeachField().
-    TINT_REFLECT(Options, allowed_features, mode);
+    TINT_REFLECT(Options, allowed_features, mode, lexer_thread_count);
 };
 
 }  // namespace tint::wgsl::reader
@@ -80,6 +80,10 @@ tint_target_add_dependencies(tint_lang_wgsl_reader_parser lib
   tint_utils_traits
 )
 
+tint_target_add_external_dependencies(tint_lang_wgsl_reader_parser lib
+  "thread"
+)
+
 endif(TINT_BUILD_WGSL_READER)
 if(TINT_BUILD_WGSL_READER)
 ################################################################################
@@ -27,13 +27,16 @@
 
 #include "src/tint/lang/wgsl/reader/parser/lexer.h"
 
-#include <cctype>
+#include <algorithm>
 #include <charconv>
 #include <cmath>
 #include <cstring>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <tuple>
 #include <utility>
 
@@ -58,6 +61,14 @@ static_assert(sizeof(decltype(tint::Source::FileContent::data[0])) == sizeof(uin
 // programs and being a bit bigger then those need (atan2-const-eval is the outlier here).
 static constexpr size_t kDefaultListSize = 4092;
 
+// The benchmark programs average between 3 and 5 bytes of source per token. Larger sources reserve
+// the token list from their size so that lexing them doesn't repeatedly grow and move the list.
+static constexpr size_t kSourceBytesPerToken = 4;
+
+// The smallest amount of source that LexConcurrently() hands to a thread. Smaller sources lex
+// faster than a thread starts.
+static constexpr size_t kMinSourceBytesPerThread = 64 * 1024;
+
 bool read_blankspace(std::string_view str,
                      size_t i,
                      bool* is_blankspace,
@@ -86,6 +97,21 @@ bool read_blankspace(std::string_view str,
     return true;
 }
 
+/// @returns true if `ch` is a byte below 0x80, which is a complete UTF-8 code point by itself.
+bool is_ascii(char ch) {
+    return static_cast<uint8_t>(ch) < 0x80;
+}
+
+/// @returns true if `ch` is an ASCII XID_Start character or an underscore
+bool is_ascii_ident_start(char ch) {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_';
+}
+
+/// @returns true if `ch` is an ASCII XID_Continue character
+bool is_ascii_ident_continue(char ch) {
+    return is_ascii_ident_start(ch) || (ch >= '0' && ch <= '9');
+}
+
 uint32_t dec_value(char c) {
     if (c >= '0' && c <= '9') {
         return static_cast<uint32_t>(c - '0');
@@ -108,13 +134,20 @@ uint32_t hex_value(char c) {
 
 }  // namespace
 
-Lexer::Lexer(const Source::File* file) : file_(file), location_{1, 1} {}
+Lexer::Lexer(const Source::File* file)
+    : Lexer(file,
+            1,
+            static_cast<uint32_t>(file->content.lines.size()),
+            file->content.data.size()) {}
+
+Lexer::Lexer(const Source::File* file, uint32_t first_line, uint32_t last_line, size_t size)
+    : file_(file), last_line_(last_line), size_(size), location_{first_line, 1} {}
 
 Lexer::~Lexer() = default;
 
 std::vector<Token> Lexer::Lex() {
     std::vector<Token> tokens;
-    tokens.reserve(kDefaultListSize);
+    tokens.reserve(std::max(kDefaultListSize, size_ / kSourceBytesPerToken));
 
     while (true) {
         tokens.emplace_back(next());
@@ -134,6 +167,77 @@ std::vector<Token> Lexer::Lex() {
     return tokens;
 }
 
+std::vector<Token> Lexer::LexConcurrently(uint32_t thread_count) {
+    const auto& lines = file_->content.lines;
+    const size_t chunk_count =
+        std::min<size_t>(thread_count, file_->content.data.size() / kMinSourceBytesPerThread);
+    if (chunk_count < 2) {
+        return Lex();
+    }
+
+    // Split the lines into chunks of roughly equal size. Tokens never span lines, so a chunk lexes
+    // to the same tokens as the whole source does for these lines, unless the chunk starts inside
+    // a block comment. The preceding chunk then ends with an unterminated block comment error.
+    std::vector<Lexer> chunks;
+    chunks.reserve(chunk_count);
+    const size_t bytes_per_chunk = file_->content.data.size() / chunk_count;
+    uint32_t first_line = 1;
+    size_t size = 0;
+    for (uint32_t line = 1; line <= lines.size(); line++) {
+        size += lines[line - 1].size() + 1;
+        if ((size >= bytes_per_chunk && chunks.size() + 1 < chunk_count) || line == lines.size()) {
+            chunks.emplace_back(Lexer(file_, first_line, line, size));
+            first_line = line + 1;
+            size = 0;
+        }
+    }
+
+    std::vector<std::vector<Token>> tokens(chunks.size());
+    std::vector<std::thread> helpers;
+    helpers.reserve(chunks.size() - 1);
+    size_t next_chunk = 1;
+    for (; next_chunk < chunks.size(); next_chunk++) {
+        auto lex = [&chunks, &tokens, i = next_chunk] { tokens[i] = chunks[i].Lex(); };
+#if defined(__cpp_exceptions)
+        try {
+            helpers.emplace_back(lex);
+        } catch (const std::system_error&) {
+            // Failing to create a thread only reduces the parallelism. The remaining chunks are
+            // lexed on the calling thread.
+            break;
+        }
+#else
+        helpers.emplace_back(lex);
+#endif
+    }
+    tokens[0] = chunks[0].Lex();
+    for (; next_chunk < chunks.size(); next_chunk++) {
+        tokens[next_chunk] = chunks[next_chunk].Lex();
+    }
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+
+    for (auto& chunk_tokens : tokens) {
+        if (chunk_tokens.back().IsError()) {
+            return Lex();
+        }
+    }
+
+    // Join the chunks, dropping the EOF token of all but the last one.
+    size_t token_count = 1;
+    for (auto& chunk_tokens : tokens) {
+        token_count += chunk_tokens.size() - 1;
+    }
+    std::vector<Token> result = std::move(tokens[0]);
+    result.reserve(token_count);
+    for (size_t i = 1; i < tokens.size(); i++) {
+        result.pop_back();
+        std::move(tokens[i].begin(), tokens[i].end(), std::back_inserter(result));
+    }
+    return result;
+}
+
 std::string_view Lexer::line() const {
     if (file_->content.lines.size() == 0) {
         static const char* empty_string = "";
@@ -179,7 +283,7 @@ void Lexer::advance_line() {
 }
 
 bool Lexer::is_eof() const {
-    return location_.line >= file_->content.lines.size() && pos() >= length();
+    return location_.line >= last_line_ && pos() >= length();
 }
 
 bool Lexer::is_eol() const {
@@ -191,20 +295,24 @@ Token Lexer::next() {
         return std::move(t.value());
     }
 
-    if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+    // Numeric literals always start with a digit or a '.', so identifiers and most punctuation
+    // can skip the numeric rules.
+    if (const char ch = at(pos()); is_digit(ch) || ch == '.') {
+        if (auto t = try_hex_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+        if (auto t = try_hex_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
-    }
+        if (auto t = try_float(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
 
-    if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
-        return std::move(t.value());
+        if (auto t = try_integer(); t.has_value() && !t->IsUninitialized()) {
+            return std::move(t.value());
+        }
     }
 
     if (auto t = try_ident(); t.has_value() && !t->IsUninitialized()) {
@@ -236,10 +344,10 @@ bool Lexer::is_null() const {
 }
 
 bool Lexer::is_digit(char ch) const {
-    return std::isdigit(static_cast<unsigned char>(ch));
+    return ch >= '0' && ch <= '9';
 }
 bool Lexer::is_hex(char ch) const {
-    return std::isxdigit(static_cast<unsigned char>(ch));
+    return is_digit(ch) || (ch >= 'a' && ch <= 'f') || (ch >= 'A' && ch <= 'F');
 }
 
 bool Lexer::matches(uint32_t pos, std::string_view sub_string) {
@@ -265,6 +373,22 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path for runs of ASCII blankspace. Line breaks have already been removed by
+            // the line splitting, so the only ASCII blankspace left is space and horizontal tab,
+            // and any other ASCII character ends the blankspace without needing to be decoded.
+            auto l = line();
+            uint32_t p = pos();
+            if (is_ascii(l[p])) {
+                while (p < l.size() && (l[p] == ' ' || l[p] == '\t')) {
+                    p++;
+                }
+                if (p == pos()) {
+                    break;
+                }
+                set_pos(p);
+                continue;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -296,14 +420,19 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 }
 
 std::optional<Token> Lexer::skip_comment() {
+    // Both comment forms start with a '/'.
+    if (at(pos()) != '/') {
+        return {};
+    }
+
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        auto rest = line().substr(pos());
+        if (auto null_pos = rest.find('\0'); null_pos != std::string_view::npos) {
+            advance(static_cast<uint32_t>(null_pos));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        set_pos(length());
         return {};
     }
 
@@ -332,8 +461,14 @@ std::optional<Token> Lexer::skip_comment() {
             } else if (is_null()) {
                 return Token{Token::Type::kError, begin_source(), "null character found"};
             } else {
-                // Anything else: skip and update source location.
-                advance();
+                // Anything else: skip and update source location. Only '/', '*' and null
+                // characters need attention, so skip everything up to the next one of these.
+                auto l = line();
+                uint32_t p = pos() + 1;
+                while (p < l.size() && l[p] != '/' && l[p] != '*' && l[p] != '\0') {
+                    p++;
+                }
+                set_pos(p);
             }
         }
         if (depth > 0) {
@@ -396,7 +531,7 @@ std::optional<Token> Lexer::try_float() {
         exponent_value_position = end;
 
         bool has_digits = false;
-        while (end < length() && isdigit(at(end))) {
+        while (end < length() && is_digit(at(end))) {
             has_digits = true;
             end++;
         }
@@ -679,7 +814,7 @@ std::optional<Token> Lexer::try_hex_float() {
         // Allow overflow (in uint64_t) when the floating point value magnitude is
         // zero.
         bool has_exponent_digits = false;
-        while (end < length() && isdigit(at(end))) {
+        while (end < length() && is_digit(at(end))) {
             has_exponent_digits = true;
             auto prev_exponent = input_exponent;
             input_exponent = (input_exponent * 10) + dec_value(at(end));
@@ -984,7 +1119,12 @@ std::optional<Token> Lexer::try_ident() {
     auto start = pos();
 
     // Must begin with an XID_Source unicode character, or underscore
-    {
+    if (is_ascii(at(pos()))) {
+        if (!is_ascii_ident_start(at(pos()))) {
+            return {};
+        }
+        advance();
+    } else {
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, length() - pos());
         if (n == 0) {
@@ -999,7 +1139,18 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
-        // Must continue with an XID_Continue unicode character
+        // Must continue with an XID_Continue unicode character. ASCII runs are consumed without
+        // decoding them.
+        auto l = line();
+        uint32_t p = pos();
+        while (p < l.size() && is_ascii_ident_continue(l[p])) {
+            p++;
+        }
+        set_pos(p);
+        if (p == l.size() || is_ascii(l[p])) {
+            break;
+        }
+
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, line().size() - pos());
         if (n == 0) {
@@ -1033,29 +1184,30 @@ std::optional<Token> Lexer::try_ident() {
 std::optional<Token> Lexer::try_punctuation() {
     auto source = begin_source();
     auto type = Token::Type::kUninitialized;
+    const char ch = at(pos());
 
-    if (matches(pos(), '@')) {
+    if (ch == '@') {
         type = Token::Type::kAttr;
         advance(1);
-    } else if (matches(pos(), '(')) {
+    } else if (ch == '(') {
         type = Token::Type::kParenLeft;
         advance(1);
-    } else if (matches(pos(), ')')) {
+    } else if (ch == ')') {
         type = Token::Type::kParenRight;
         advance(1);
-    } else if (matches(pos(), '[')) {
+    } else if (ch == '[') {
         type = Token::Type::kBracketLeft;
         advance(1);
-    } else if (matches(pos(), ']')) {
+    } else if (ch == ']') {
         type = Token::Type::kBracketRight;
         advance(1);
-    } else if (matches(pos(), '{')) {
+    } else if (ch == '{') {
         type = Token::Type::kBraceLeft;
         advance(1);
-    } else if (matches(pos(), '}')) {
+    } else if (ch == '}') {
         type = Token::Type::kBraceRight;
         advance(1);
-    } else if (matches(pos(), '&')) {
+    } else if (ch == '&') {
         if (matches(pos() + 1, '&')) {
             type = Token::Type::kAndAnd;
             advance(2);
@@ -1066,7 +1218,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kAnd;
             advance(1);
         }
-    } else if (matches(pos(), '/')) {
+    } else if (ch == '/') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kDivisionEqual;
             advance(2);
@@ -1074,7 +1226,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kForwardSlash;
             advance(1);
         }
-    } else if (matches(pos(), '!')) {
+    } else if (ch == '!') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kNotEqual;
             advance(2);
@@ -1082,13 +1234,13 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kBang;
             advance(1);
         }
-    } else if (matches(pos(), ':')) {
+    } else if (ch == ':') {
         type = Token::Type::kColon;
         advance(1);
-    } else if (matches(pos(), ',')) {
+    } else if (ch == ',') {
         type = Token::Type::kComma;
         advance(1);
-    } else if (matches(pos(), '=')) {
+    } else if (ch == '=') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kEqualEqual;
             advance(2);
@@ -1096,7 +1248,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kEqual;
             advance(1);
         }
-    } else if (matches(pos(), '>')) {
+    } else if (ch == '>') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kGreaterThanEqual;
             advance(2);
@@ -1112,7 +1264,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kGreaterThan;
             advance(1);
         }
-    } else if (matches(pos(), '<')) {
+    } else if (ch == '<') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kLessThanEqual;
             advance(2);
@@ -1128,7 +1280,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kLessThan;
             advance(1);
         }
-    } else if (matches(pos(), '%')) {
+    } else if (ch == '%') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kModuloEqual;
             advance(2);
@@ -1136,7 +1288,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kMod;
             advance(1);
         }
-    } else if (matches(pos(), '-')) {
+    } else if (ch == '-') {
         if (matches(pos() + 1, '>')) {
             type = Token::Type::kArrow;
             advance(2);
@@ -1150,10 +1302,10 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kMinus;
             advance(1);
         }
-    } else if (matches(pos(), '.')) {
+    } else if (ch == '.') {
         type = Token::Type::kPeriod;
         advance(1);
-    } else if (matches(pos(), '+')) {
+    } else if (ch == '+') {
         if (matches(pos() + 1, '+')) {
             type = Token::Type::kPlusPlus;
             advance(2);
@@ -1164,7 +1316,7 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kPlus;
             advance(1);
         }
-    } else if (matches(pos(), '|')) {
+    } else if (ch == '|') {
         if (matches(pos() + 1, '|')) {
             type = Token::Type::kOrOr;
             advance(2);
@@ -1175,10 +1327,10 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kOr;
             advance(1);
         }
-    } else if (matches(pos(), ';')) {
+    } else if (ch == ';') {
         type = Token::Type::kSemicolon;
         advance(1);
-    } else if (matches(pos(), '*')) {
+    } else if (ch == '*') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kTimesEqual;
             advance(2);
@@ -1186,13 +1338,13 @@ std::optional<Token> Lexer::try_punctuation() {
             type = Token::Type::kStar;
             advance(1);
         }
-    } else if (matches(pos(), '~')) {
+    } else if (ch == '~') {
         type = Token::Type::kTilde;
         advance(1);
-    } else if (matches(pos(), '_')) {
+    } else if (ch == '_') {
         type = Token::Type::kUnderscore;
         advance(1);
-    } else if (matches(pos(), '^')) {
+    } else if (ch == '^') {
         if (matches(pos() + 1, '=')) {
             type = Token::Type::kXorEqual;
             advance(2);
@@ -1210,89 +1362,125 @@ std::optional<Token> Lexer::try_punctuation() {
 }
 
 std::optional<Token::Type> Lexer::parse_keyword(std::string_view str) {
-    if (str == "alias") {
-        return Token::Type::kAlias;
-    }
-    if (str == "break") {
-        return Token::Type::kBreak;
-    }
-    if (str == "case") {
-        return Token::Type::kCase;
-    }
-    if (str == "const") {
-        return Token::Type::kConst;
-    }
-    if (str == "const_assert") {
-        return Token::Type::kConstAssert;
-    }
-    if (str == "continue") {
-        return Token::Type::kContinue;
-    }
-    if (str == "continuing") {
-        return Token::Type::kContinuing;
-    }
-    if (str == "diagnostic") {
-        return Token::Type::kDiagnostic;
-    }
-    if (str == "discard") {
-        return Token::Type::kDiscard;
-    }
-    if (str == "default") {
-        return Token::Type::kDefault;
-    }
-    if (str == "else") {
-        return Token::Type::kElse;
-    }
-    if (str == "enable") {
-        return Token::Type::kEnable;
-    }
-    if (str == "fallthrough") {
-        return Token::Type::kFallthrough;
-    }
-    if (str == "false") {
-        return Token::Type::kFalse;
-    }
-    if (str == "fn") {
-        return Token::Type::kFn;
-    }
-    if (str == "for") {
-        return Token::Type::kFor;
-    }
-    if (str == "if") {
-        return Token::Type::kIf;
-    }
-    if (str == "let") {
-        return Token::Type::kLet;
-    }
-    if (str == "loop") {
-        return Token::Type::kLoop;
-    }
-    if (str == "override") {
-        return Token::Type::kOverride;
-    }
-    if (str == "return") {
-        return Token::Type::kReturn;
-    }
-    if (str == "requires") {
-        return Token::Type::kRequires;
-    }
-    if (str == "struct") {
-        return Token::Type::kStruct;
-    }
-    if (str == "switch") {
-        return Token::Type::kSwitch;
-    }
-    if (str == "true") {
-        return Token::Type::kTrue;
-    }
-    if (str == "var") {
-        return Token::Type::kVar;
-    }
-    if (str == "while") {
-        return Token::Type::kWhile;
-    }
-    if (str == "_") {
-        return Token::Type::kUnderscore;
+    // Dispatch on the first character so that identifiers are compared against at most a handful
+    // of keywords, instead of all of them.
+    switch (str[0]) {
+        case '_':
+            if (str == "_") {
+                return Token::Type::kUnderscore;
+            }
+            break;
+        case 'a':
+            if (str == "alias") {
+                return Token::Type::kAlias;
+            }
+            break;
+        case 'b':
+            if (str == "break") {
+                return Token::Type::kBreak;
+            }
+            break;
+        case 'c':
+            if (str == "case") {
+                return Token::Type::kCase;
+            }
+            if (str == "const") {
+                return Token::Type::kConst;
+            }
+            if (str == "const_assert") {
+                return Token::Type::kConstAssert;
+            }
+            if (str == "continue") {
+                return Token::Type::kContinue;
+            }
+            if (str == "continuing") {
+                return Token::Type::kContinuing;
+            }
+            break;
+        case 'd':
+            if (str == "diagnostic") {
+                return Token::Type::kDiagnostic;
+            }
+            if (str == "discard") {
+                return Token::Type::kDiscard;
+            }
+            if (str == "default") {
+                return Token::Type::kDefault;
+            }
+            break;
+        case 'e':
+            if (str == "else") {
+                return Token::Type::kElse;
+            }
+            if (str == "enable") {
+                return Token::Type::kEnable;
+            }
+            break;
+        case 'f':
+            if (str == "fallthrough") {
+                return Token::Type::kFallthrough;
+            }
+            if (str == "false") {
+                return Token::Type::kFalse;
+            }
+            if (str == "fn") {
+                return Token::Type::kFn;
+            }
+            if (str == "for") {
+                return Token::Type::kFor;
+            }
+            break;
+        case 'i':
+            if (str == "if") {
+                return Token::Type::kIf;
+            }
+            break;
+        case 'l':
+            if (str == "let") {
+                return Token::Type::kLet;
+            }
+            if (str == "loop") {
+                return Token::Type::kLoop;
+            }
+            break;
+        case 'o':
+            if (str == "override") {
+                return Token::Type::kOverride;
+            }
+            break;
+        case 'r':
+            if (str == "return") {
+                return Token::Type::kReturn;
+            }
+            if (str == "requires") {
+                return Token::Type::kRequires;
+            }
+            break;
+        case 's':
+            if (str == "struct") {
+                return Token::Type::kStruct;
+            }
+            if (str == "switch") {
+                return Token::Type::kSwitch;
+            }
+            break;
+        case 't':
+            if (str == "true") {
+                return Token::Type::kTrue;
+            }
+            break;
+        case 'v':
+            if (str == "var") {
+                return Token::Type::kVar;
+            }
+            break;
+        case 'w':
+            if (str == "while") {
+                return Token::Type::kWhile;
+            }
+            break;
+        default:
+            break;
     }
     return std::nullopt;
 }
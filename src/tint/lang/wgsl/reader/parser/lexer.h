@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_WGSL_READER_PARSER_LEXER_H_
 #define SRC_TINT_LANG_WGSL_READER_PARSER_LEXER_H_
 
+#include <cstdint>
 #include <optional>
 #include <vector>
 
@@ -46,7 +47,22 @@ class Lexer {
     /// @return the token list.
     std::vector<Token> Lex();
 
+    /// Lexes the source using up to `thread_count` threads. Large sources are split into chunks at
+    /// line boundaries which are lexed concurrently and then joined. If any chunk fails to lex,
+    /// for example because a block comment spans two chunks, the whole source is lexed again on
+    /// the calling thread so that the result and any diagnostic match Lex().
+    /// @param thread_count the maximum number of threads to use, including the calling thread
+    /// @return the token list.
+    std::vector<Token> LexConcurrently(uint32_t thread_count);
+
   private:
+    /// Creates a new Lexer for the lines [`first_line`, `last_line`] of a source file
+    /// @param file the source file
+    /// @param first_line the 1-based index of the first line to lex
+    /// @param last_line the 1-based index of the last line to lex
+    /// @param size the number of bytes in the lines to lex
+    Lexer(const Source::File* file, uint32_t first_line, uint32_t last_line, size_t size);
+
     /// Returns the next token in the input stream.
     /// @return Token
     Token next();
@@ -120,6 +136,10 @@ class Lexer {
     bool matches(uint32_t pos, char ch);
     /// The source file content
     Source::File const* const file_;
+    /// The 1-based index of the last line to lex
+    uint32_t const last_line_;
+    /// The number of bytes to lex
+    size_t const size_;
     /// The current location within the input
     Source::Location location_;
 };
@@ -399,6 +399,196 @@ TEST_F(LexerTest, Null_InIdentifier_IsError) {
     }
 }
 
+TEST_F(LexerTest, Skips_Blankspace_MixedAsciiAndUnicode) {
+    Source::File file("", kSpace kHTab kL2R kSpace kSpace kR2L kHTab "a" kSpace kL2R "b");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(3u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 1u);
+        EXPECT_EQ(t.source().range.begin.column, 12u);
+        EXPECT_EQ(t.source().range.end.line, 1u);
+        EXPECT_EQ(t.source().range.end.column, 13u);
+        EXPECT_EQ(t.to_str(), "a");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 1u);
+        EXPECT_EQ(t.source().range.begin.column, 17u);
+        EXPECT_EQ(t.source().range.end.line, 1u);
+        EXPECT_EQ(t.source().range.end.column, 18u);
+        EXPECT_EQ(t.to_str(), "b");
+    }
+
+    {
+        auto& t = list[2];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
+TEST_F(LexerTest, Skips_Comments_Line_NonAscii) {
+    Source::File file("", "// caf\xC3\xA9 /* */ ** \xF0\x9D\x90\xA2" kLF "ident");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 2u);
+        EXPECT_EQ(t.source().range.begin.column, 1u);
+        EXPECT_EQ(t.source().range.end.line, 2u);
+        EXPECT_EQ(t.source().range.end.column, 6u);
+        EXPECT_EQ(t.to_str(), "ident");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
+TEST_F(LexerTest, Skips_Comments_Block_StrayStarsAndSlashes) {
+    Source::File file("", "/* a*b/c ** // / * caf\xC3\xA9 *" kLF "*/ident");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.line, 2u);
+        EXPECT_EQ(t.source().range.begin.column, 3u);
+        EXPECT_EQ(t.source().range.end.line, 2u);
+        EXPECT_EQ(t.source().range.end.column, 8u);
+        EXPECT_EQ(t.to_str(), "ident");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
+TEST_F(LexerTest, Null_AfterTextInBlockComment_IsError) {
+    Source::File file("", std::string{'/', '*', ' ', 'a', 'b', 'c', 0, '*', '/'});
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(1u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsError());
+    EXPECT_EQ(t.source().range.begin.line, 1u);
+    EXPECT_EQ(t.source().range.begin.column, 7u);
+    EXPECT_EQ(t.source().range.end.line, 1u);
+    EXPECT_EQ(t.source().range.end.column, 7u);
+    EXPECT_EQ(t.to_str(), "null character found");
+}
+
+// Returns WGSL source of at least `size` bytes, made of copies of a small function.
+std::string LargeSource(size_t size) {
+    std::string source;
+    for (size_t i = 0; source.size() < size; i++) {
+        source += "// function " + std::to_string(i) + "\n";
+        source += "fn f" + std::to_string(i) + "(a : vec3<f32>) -> i32 {\n";
+        source += "  let b = array<i32, 2>(1i, 0x10);\n";
+        source += "  return b[0] >> 1u + i32(a.x * 1.5e3f + 0x1p4);\n";
+        source += "}\n\n";
+    }
+    return source;
+}
+
+// Checks that LexConcurrently() returns the same tokens as Lex() for `source`.
+void ExpectConcurrentLexMatches(const std::string& source, uint32_t thread_count) {
+    Source::File file("", source);
+    auto expected = Lexer(&file).Lex();
+    auto got = Lexer(&file).LexConcurrently(thread_count);
+
+    ASSERT_EQ(expected.size(), got.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].type(), got[i].type()) << "token " << i;
+        EXPECT_TRUE(expected[i].source().range == got[i].source().range) << "token " << i;
+        EXPECT_EQ(expected[i].to_str(), got[i].to_str()) << "token " << i;
+    }
+}
+
+TEST_F(LexerTest, LexConcurrently_SmallSource) {
+    ExpectConcurrentLexMatches("fn f() -> i32 { return 1 >> 2; }", 4);
+}
+
+TEST_F(LexerTest, LexConcurrently_LargeSource) {
+    auto source = LargeSource(512 * 1024);
+    for (uint32_t thread_count : {2u, 3u, 8u}) {
+        SCOPED_TRACE(thread_count);
+        ExpectConcurrentLexMatches(source, thread_count);
+    }
+}
+
+TEST_F(LexerTest, LexConcurrently_BlockCommentAcrossChunks) {
+    // The block comment covers the middle of the source, where it is split in two chunks.
+    std::string source = LargeSource(100 * 1024) + "/* start\n" + LargeSource(100 * 1024) +
+                         "end */\n" + LargeSource(100 * 1024);
+    ExpectConcurrentLexMatches(source, 2);
+}
+
+TEST_F(LexerTest, LexConcurrently_Error) {
+    std::string source = LargeSource(256 * 1024);
+    source[source.size() / 2] = 0;
+    Source::File file("", source);
+    auto list = Lexer(&file).LexConcurrently(4);
+    ASSERT_FALSE(list.empty());
+    EXPECT_TRUE(list.back().IsError());
+    ExpectConcurrentLexMatches(source, 4);
+}
+
+TEST_F(LexerTest, LexConcurrently_UnterminatedBlockComment) {
+    std::string source = LargeSource(256 * 1024) + "/* unterminated\n";
+    Source::File file("", source);
+    auto list = Lexer(&file).LexConcurrently(2);
+    ASSERT_FALSE(list.empty());
+    EXPECT_TRUE(list.back().IsError());
+    EXPECT_EQ(list.back().to_str(), "unterminated block comment");
+    ExpectConcurrentLexMatches(source, 2);
+}
+
+TEST_F(LexerTest, IdentifierTest_EndsAtNonAsciiBlankspace) {
+    Source::File file("", "abc" kL2R "def");
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(3u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.column, 1u);
+        EXPECT_EQ(t.source().range.end.column, 4u);
+        EXPECT_EQ(t.to_str(), "abc");
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.source().range.begin.column, 7u);
+        EXPECT_EQ(t.source().range.end.column, 10u);
+        EXPECT_EQ(t.to_str(), "def");
+    }
+
+    {
+        auto& t = list[2];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
 struct FloatData {
     const char* input;
     double result;
@@ -696,6 +886,12 @@ INSTANTIATE_TEST_SUITE_P(
                     "\xf0\x9d\x96\x99\xf0\x9d\x96\x8e\xf0\x9d\x96\x8b\xf0\x9d\x96\x8e"
                     "\xf0\x9d\x96\x8a\xf0\x9d\x96\x97\x31\x32\x33",
                     43},
+        UnicodeCase{// "abécd"
+                    "ab\xc3\xa9" "cd", 6},
+        UnicodeCase{// "_é_1"
+                    "_\xc3\xa9_1", 5},
+        UnicodeCase{// "é_abc"
+                    "\xc3\xa9_abc", 6},
     }));
 
 using InvalidUnicodeIdentifierTest = testing::TestWithParam<const char*>;
@@ -1151,5 +1347,45 @@ INSTANTIATE_TEST_SUITE_P(LexerTest,
                                          TokenData{"var", Token::Type::kVar},
                                          TokenData{"while", Token::Type::kWhile}));
 
+using KeywordLikeIdentifierTest = testing::TestWithParam<const char*>;
+TEST_P(KeywordLikeIdentifierTest, Parses) {
+    Source::File file("", GetParam());
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(2u, list.size());
+
+    auto& t = list[0];
+    EXPECT_TRUE(t.IsIdentifier()) << GetParam();
+    EXPECT_EQ(t.to_str(), GetParam());
+    EXPECT_TRUE(list[1].IsEof());
+}
+INSTANTIATE_TEST_SUITE_P(LexerTest,
+                         KeywordLikeIdentifierTest,
+                         testing::Values("_a",
+                                         "a",
+                                         "aliases",
+                                         "c",
+                                         "cas",
+                                         "constant",
+                                         "const_assert_",
+                                         "continu",
+                                         "d",
+                                         "discarded",
+                                         "elseif",
+                                         "f",
+                                         "fo",
+                                         "forever",
+                                         "i",
+                                         "iff",
+                                         "lets",
+                                         "overrides",
+                                         "re",
+                                         "structs",
+                                         "True",
+                                         "vars",
+                                         "whilst",
+                                         "z"));
+
 }  // namespace
 }  // namespace tint::wgsl::reader
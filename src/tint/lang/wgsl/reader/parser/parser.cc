@@ -328,7 +328,7 @@ Source Parser::last_source() const {
 
 void Parser::InitializeLex() {
     Lexer l{file_};
-    tokens_ = l.Lex();
+    tokens_ = lexer_thread_count_ > 1 ? l.LexConcurrently(lexer_thread_count_) : l.Lex();
     ClassifyTemplateArguments(tokens_);
 }
 
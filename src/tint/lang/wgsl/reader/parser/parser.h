@@ -319,6 +319,10 @@ class Parser {
     /// @param limit the new maximum number of errors
     void set_max_errors(size_t limit) { max_errors_ = limit; }
 
+    /// set_lexer_thread_count sets the maximum number of threads used to lex the source.
+    /// @param count the new maximum number of threads
+    void set_lexer_thread_count(uint32_t count) { lexer_thread_count_ = count; }
+
     /// @return the number of maximum number of reported errors before aborting
     /// parsing.
     size_t get_max_errors() const { return max_errors_; }
@@ -920,6 +924,7 @@ class Parser {
     int silence_diags_ = 0;
     ProgramBuilder builder_;
     size_t max_errors_ = 25;
+    uint32_t lexer_thread_count_ = 1;
 };
 
 }  // namespace tint::wgsl::reader
@@ -45,6 +45,7 @@ Program Parse(const Source::File* file, const Options& options) {
         return Program(std::move(b));
     }
     Parser parser(file);
+    parser.set_lexer_thread_count(options.lexer_thread_count);
     parser.Parse();
     return resolver::Resolve(parser.builder(), options.allowed_features, options.mode);
 }
@@ -279,6 +279,7 @@ class HashmapBase {
             }
             slots_[slot_idx].nodes = nullptr;
         }
+        count_ = 0;
     }
 
     /// Ensures that the map can hold @p n entries without heap reallocation or rehashing.
@@ -289,6 +290,9 @@ class HashmapBase {
             size_t count = n - capacity_;
             free_.Allocate(count);
             capacity_ += count;
+            // EditAt() only rehashes when the free nodes are exhausted, so grow the slots now to
+            // keep the slot lists short while the reserved nodes are consumed.
+            Rehash();
         }
     }
 
@@ -0,0 +1,166 @@
+// Copyright 2024 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/hashset.h"
+
+namespace tint {
+namespace {
+
+/// @returns @p count distinct pointer keys, allocated in a single block like AST / IR nodes.
+std::vector<const int*> MakePointerKeys(std::vector<int>& storage, size_t count) {
+    storage.resize(count * 2);
+    std::vector<const int*> keys;
+    for (size_t i = 0; i < count; i++) {
+        keys.push_back(&storage[i * 2]);
+    }
+    return keys;
+}
+
+void HashmapAdd(::benchmark::State& state) {
+    std::vector<int> storage;
+    auto keys = MakePointerKeys(storage, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Hashmap<const int*, size_t, 8> map;
+        for (size_t i = 0; i < keys.size(); i++) {
+            map.Add(keys[i], i);
+        }
+        ::benchmark::DoNotOptimize(map.Count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapAdd)->Arg(8)->Arg(64)->Arg(1024)->Arg(16384);
+
+void HashmapAddReserved(::benchmark::State& state) {
+    std::vector<int> storage;
+    auto keys = MakePointerKeys(storage, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Hashmap<const int*, size_t, 8> map;
+        map.Reserve(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            map.Add(keys[i], i);
+        }
+        ::benchmark::DoNotOptimize(map.Count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(HashmapAddReserved)->Arg(64)->Arg(1024);
+
+void HashmapGetHit(::benchmark::State& state) {
+    std::vector<int> storage;
+    auto keys = MakePointerKeys(storage, static_cast<size_t>(state.range(0)));
+    Hashmap<const int*, size_t, 8> map;
+    for (size_t i = 0; i < keys.size(); i++) {
+        map.Add(keys[i], i);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(map.Get(keys[i]));
+        i = (i + 7) % keys.size();
+    }
+}
+
+BENCHMARK(HashmapGetHit)->Arg(8)->Arg(64)->Arg(1024)->Arg(16384);
+
+void HashmapGetMiss(::benchmark::State& state) {
+    std::vector<int> storage;
+    auto keys = MakePointerKeys(storage, static_cast<size_t>(state.range(0)));
+    Hashmap<const int*, size_t, 8> map;
+    for (size_t i = 0; i < keys.size(); i++) {
+        map.Add(keys[i], i);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        // Odd elements of the storage are never used as keys.
+        ::benchmark::DoNotOptimize(map.Get(keys[i] + 1));
+        i = (i + 7) % keys.size();
+    }
+}
+
+BENCHMARK(HashmapGetMiss)->Arg(8)->Arg(64)->Arg(1024)->Arg(16384);
+
+void HashmapAddRemove(::benchmark::State& state) {
+    std::vector<int> storage;
+    auto keys = MakePointerKeys(storage, static_cast<size_t>(state.range(0)));
+    Hashmap<const int*, size_t, 8> map;
+    size_t i = 0;
+    for (auto _ : state) {
+        map.Add(keys[i], i);
+        map.Remove(keys[(i + keys.size() / 2) % keys.size()]);
+        i = (i + 1) % keys.size();
+    }
+}
+
+BENCHMARK(HashmapAddRemove)->Arg(64)->Arg(1024);
+
+void HashmapGetHitRandomInts(::benchmark::State& state) {
+    std::mt19937 rnd;
+    std::vector<uint32_t> keys;
+    Hashmap<uint32_t, size_t, 8> map;
+    while (keys.size() < static_cast<size_t>(state.range(0))) {
+        uint32_t key = static_cast<uint32_t>(rnd());
+        if (map.Add(key, keys.size())) {
+            keys.push_back(key);
+        }
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(map.Get(keys[i]));
+        i = (i + 7) % keys.size();
+    }
+}
+
+BENCHMARK(HashmapGetHitRandomInts)->Arg(64)->Arg(1024)->Arg(16384);
+
+void HashsetStringContains(::benchmark::State& state) {
+    std::vector<std::string> keys;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        keys.push_back("identifier_" + std::to_string(i));
+    }
+    Hashset<std::string, 8> set;
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        set.Add(keys[i]);
+    }
+    size_t i = 0;
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(set.Contains(keys[i]));
+        i = (i + 7) % keys.size();
+    }
+}
+
+BENCHMARK(HashsetStringContains)->Arg(64)->Arg(1024);
+
+}  // namespace
+}  // namespace tint
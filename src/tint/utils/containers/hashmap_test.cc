@@ -468,6 +468,69 @@ TEST(Hashmap, Soak) {
     }
 }
 
+TEST(Hashmap, SoakManyKeys) {
+    std::mt19937 rnd;
+    std::unordered_map<int, int> reference;
+    Hashmap<int, int, 4> map;
+    for (size_t i = 0; i < 200000; i++) {
+        int key = static_cast<int>(rnd() % 1000);
+        switch (rnd() % 4) {
+            case 0:
+            case 1: {  // Add
+                auto expected = reference.emplace(key, key * 2).second;
+                EXPECT_EQ(map.Add(key, key * 2).added, expected) << "i:" << i;
+                break;
+            }
+            case 2: {  // Remove
+                auto expected = reference.erase(key) != 0;
+                EXPECT_EQ(map.Remove(key), expected) << "i:" << i;
+                break;
+            }
+            case 3: {  // Get
+                auto it = reference.find(key);
+                if (it != reference.end()) {
+                    EXPECT_EQ(map.Get(key), it->second) << "i:" << i;
+                } else {
+                    EXPECT_FALSE(map.Get(key)) << "i:" << i;
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(map.Count(), reference.size()) << "i:" << i;
+    }
+    size_t count = 0;
+    for (auto& it : map) {
+        EXPECT_EQ(reference[it.key.Value()], it.value);
+        count++;
+    }
+    EXPECT_EQ(count, reference.size());
+}
+
+TEST(Hashmap, EntryPointersStableWhenGrowing) {
+    Hashmap<int, int, 8> map;
+    map.Add(0, 100);
+    auto* first = map.Get(0).value;
+    for (int i = 1; i < 1000; i++) {
+        map.Add(i, i + 100);
+    }
+    EXPECT_EQ(map.Get(0).value, first);
+    EXPECT_EQ(*first, 100);
+}
+
+TEST(Hashmap, ClearResetsCount) {
+    Hashmap<int, int, 8> map;
+    for (int i = 0; i < 100; i++) {
+        map.Add(i, i);
+    }
+    map.Clear();
+    EXPECT_EQ(map.Count(), 0u);
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_TRUE(map.begin() == map.end());
+    map.Add(5, 5);
+    EXPECT_EQ(map.Count(), 1u);
+    EXPECT_EQ(map.Get(5), 5);
+}
+
 TEST(Hashmap, EqualitySameSize) {
     Hashmap<int, std::string, 8> a;
     Hashmap<int, std::string, 8> b;
@@ -97,7 +97,7 @@ struct Hasher<T*> {
         hash ^= static_cast<uint32_t>(TINT_HASH_SEED);
 #endif
         if constexpr (sizeof(hash) > 4) {
-            return static_cast<HashCode>(hash >> 4 | hash >> 32);
+            return static_cast<HashCode>((hash >> 4) ^ (hash >> 32));
         } else {
             return static_cast<HashCode>(hash >> 4);
         }
@@ -30,6 +30,8 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "src/tint/utils/containers/vector.h"
@@ -44,6 +46,17 @@ TEST(HashTests, Basic) {
     EXPECT_EQ(Hash(std::string("hello")), Hash(std::string("hello")));
 }
 
+TEST(HashTests, Pointers) {
+    // Pointers that differ in bits above the low 4 must hash to distinct values, regardless of the
+    // upper 32 bits of the address.
+    std::vector<uint64_t> storage(1024);
+    std::unordered_set<HashCode> hashes;
+    for (size_t i = 0; i < storage.size(); i += 2) {
+        hashes.emplace(Hasher<uint64_t*>{}(&storage[i]));
+    }
+    EXPECT_EQ(hashes.size(), storage.size() / 2);
+}
+
 TEST(HashTests, StdVector) {
     EXPECT_EQ(Hash(std::vector<int>({})), Hash(std::vector<int>({})));
     EXPECT_EQ(Hash(std::vector<int>({1, 2, 3})), Hash(std::vector<int>({1, 2, 3})));